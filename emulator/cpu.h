@@ -23,16 +23,39 @@ typedef struct cpu_t {
 	bool tlb_or_cache_flush_pending;
 
 	bool dynarec_enabled;
+	// NOTE : cached by `cpu_update_interrupt_deliverable`, it might be true while no interrupt is deliverable
+	bool interrupt_deliverable;
 
 	guest_reg regs[REG_COUNT];
 
 	cpu_csrs_t csrs;
 
 	privilege_mode_t priv_mode;
+	mmu_vg2pg_mode_t vg2pg_mode;
 
 	mmu_vg2pg_tlb_entry_t* vg2pg_tlb;
 	guest_vaddr vg2pg_tlb_mask;
 
+	// NOTE : the page-walk cache is indexed by level of the next table, it is emptied when the root table changes
+	mmu_vg2pg_pwc_entry_t vg2pg_pwc[2][MMU_VG2PG_PWC_SIZE];
+	guest_paddr vg2pg_pwc_root;
+	mmu_vg2pg_pte* vg2pg_pwc_root_host;
+
+	// NOTE : the TLBs of all the contexts are stored contiguously, indexed by mmu_vg2h_context_t
+	mmu_vg2h_tlb_entry_t* vg2h_tlb;
+	mmu_vg2h_itlb_entry_t* vg2h_itlb;
+	guest_vaddr vg2h_tlb_mask;
+	// NOTE : both are kept up to date by `mmu_vg2pg_context_changed`
+	mmu_vg2h_tlb_entry_t* vg2h_data_tlb;
+	mmu_vg2h_itlb_entry_t* vg2h_fetch_itlb;
+	// NOTE : bit fields of the contexts filled since their last flush and the value of MXR they were filled with
+	uint8_t vg2h_tlb_used;
+	uint8_t vg2h_itlb_used;
+	bool vg2h_mxr;
+	// NOTE : tag of the last page translated by the instruction fetch TLB, sequential fetches don't index the ITLB again
+	guest_vaddr vg2h_fetch_page;
+	uintptr_t vg2h_fetch_page_addend;
+
 	union {
 		void* as_ptr;
 		cached_ins_t* as_cached_ins;
@@ -41,8 +64,31 @@ typedef struct cpu_t {
 #endif
 	} instruction_cache;
 	guest_vaddr instruction_cache_mask;
+
+#ifdef RISCV_EMULATOR_DYNAREC_X86_64_SUPPORT
+	dr_page_cache_entry_t dr_page_cache[REG_COUNT];
+	uint64_t dr_code_pages[DYNAREC_CODE_PAGES_SIZE];
+	dr_hot_region_t dr_hot_region;
+
+	// NOTE : number of consecutive entries in the emitted code at the same guest address
+	guest_vaddr dr_last_entry;
+	uint64_t dr_self_loops;
+
+	// NOTE : instructions the loops executed in bulk may still retire, and those they retired, during a block
+	uint64_t dr_idiom_budget;
+	uint64_t dr_idiom_retired;
+#endif
 } cpu_t;
 
+/* CPU_INSTRUCTION_CACHE_TAG : macro used to get the tag of an instruction in the instruction cache,
+ *                             the entries are specialized on the translation of the instruction
+ *                             fetches which is stored in the lower bit of the tag
+ */
+#define CPU_INSTRUCTION_CACHE_TAG(cpu, vaddr) ((vaddr) | ((cpu)->vg2pg_mode & MMU_VG2PG_MODE_TRANSLATE_FETCH))
+
+static_assert(MMU_VG2PG_MODE_TRANSLATE_FETCH < 4,
+	      "The translation of instruction fetches should fit in the unused bits of the tag");
+
 // NOTE : forward declaration to deal with a cyclic dependency with emulator.h
 typedef struct emulator_t emulator_t;
 
@@ -58,11 +104,26 @@ bool cpu_decode(uint32_t encoded_instruction, ins_t* decoded_instruction);
  *                        and fill the cache in case of a cache miss
  *                        returns true if the instruction was successfully decoded
  *                        returns false otherwise
- *     emulator_t* emu              : pointer to the emulator where the cache will be updated
- *     guest_vaddr instruction_addr : address of the instruction to decode and cache
- *     ins_t** decoded_instruction  : pointer to the ins_t* to fill with the address of the decoded instruction
+ *     emulator_t* emu                         : pointer to the emulator where the cache will be updated
+ *     guest_vaddr instruction_addr            : address of the instruction to decode and cache
+ *     const cached_ins_t** cached_instruction : pointer to the cached_ins_t* to fill with the address of
+ *                                               the cached instruction
+ */
+bool cpu_decode_and_cache(emulator_t* emu, guest_vaddr instruction_addr, const cached_ins_t** cached_instruction);
+
+/* cpu_resolve_handler : get the handler executing a decoded instruction, the immediate of the
+ *                       instructions depending on it is validated once here
+ *     const ins_t* instruction : decoded instruction
  */
-bool cpu_decode_and_cache(emulator_t* emu, guest_vaddr instruction_addr, ins_t** decoded_instruction);
+cpu_handler_t cpu_resolve_handler(const ins_t* instruction);
+
+/* cpu_resolve_fused_handler : get the handler of the superinstruction executing two consecutive
+ *                             instructions
+ *                             returns NULL if the pair can't be fused
+ *     cpu_handler_t first  : handler of the first instruction
+ *     cpu_handler_t second : handler of the second instruction
+ */
+cpu_handler_t cpu_resolve_fused_handler(cpu_handler_t first, cpu_handler_t second);
 
 /* cpu_invalidate_instruction_cache : invalidate an entry in the instruction cache
  *                                    returns true if an entry was invalidated
@@ -77,9 +138,18 @@ bool cpu_invalidate_instruction_cache(emulator_t* emu, guest_vaddr addr);
  */
 void cpu_flush_instruction_cache(emulator_t* emu);
 
-/* cpu_execute : execute a single instruction at the CPU PC
- *     emulator_t* emu : pointer to the emulator state to update to the next instruction
+/* CPU_INTERPRETER_BLOCK_MAX_INSTRUCTIONS : maximum number of instructions executed by the interpreter
+ *                                          in a single call to `cpu_execute`, it bounds the latency of
+ *                                          interrupts and device updates in straight-line code
+ */
+#define CPU_INTERPRETER_BLOCK_MAX_INSTRUCTIONS 64
+
+/* cpu_execute : execute the basic block (or a single dynarec block) at the CPU PC
+ *               returns the number of instructions retired
+ *     emulator_t* emu           : pointer to the emulator state to update to the next instruction
+ *     uint64_t max_instructions : maximum number of instructions to execute, it must not be 0
+ *                                 a dynarec block is always run up to its end and may exceed it
  */
-void cpu_execute(emulator_t* emu);
+uint64_t cpu_execute(emulator_t* emu, uint64_t max_instructions);
 
 #endif
@@ -73,6 +73,9 @@ void cpu_csr_write(emulator_t* emu, guest_reg csr_num, guest_reg value) {
 			cpu_throw_exception(emu, EXC_ILL_INS, 0);
 			return;
 	}
+
+	// NOTE : CSR writes are rare enough to update the summary regardless of the written CSR
+	cpu_update_interrupt_deliverable(emu);
 }
 
 guest_reg cpu_csr_exchange(emulator_t* emu, guest_reg csr_num, guest_reg value) {
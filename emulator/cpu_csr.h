@@ -86,6 +86,7 @@ guest_reg cpu_csr_clear_bits(emulator_t* emu, guest_reg csr_num, guest_reg mask)
 		     if (mpp != U_MODE && mpp != S_MODE && mpp != M_MODE) {                                      \
 			     emu->cpu.csrs.mstatus &= ~(3 << 11);                                                \
 		     }                                                                                           \
+		     mmu_vg2pg_context_changed(emu);                                                             \
 	     } while (0))                                                                                        \
 	X_RO(CSR_MISA, (2ll << 62) |       /* MXL : XLEN=64 */                                                   \
 			       (1 << 20) | /* U mode */                                                          \
@@ -267,7 +268,7 @@ guest_reg cpu_csr_clear_bits(emulator_t* emu, guest_reg csr_num, guest_reg mask)
 						  (1 << 8) |  /* SPP : Supervisor previous privilege mode */     \
 						  (1 << 5) |  /* SPIE : Supervisor previous interrupt-enable */  \
 						  (1 << 1),   /* SIE : Supervisor interrupt-enable */            \
-		    (2ll << 32), (void)0)                     /* UXL : XLEN=64 */                                \
+		    (2ll << 32), mmu_vg2pg_context_changed(emu)) /* UXL : XLEN=64 */                             \
 	X_RW_SHADOW(CSR_SIE, mie, (1 << 9) |                  /* SEIE : Supervisor external interrupt enabled */ \
 					  (1 << 5) |          /* STIE : Supervisor timer    interrupt enabled */ \
 					  (1 << 1),           /* SSIE : Supervisor software interrupt enabled */ \
@@ -301,6 +302,7 @@ guest_reg cpu_csr_clear_bits(emulator_t* emu, guest_reg csr_num, guest_reg mask)
 			if (mode != 8 && mode != 0) {                                                            \
 				emu->cpu.csrs.satp = old_value;                                                  \
 			}                                                                                        \
+			mmu_vg2pg_context_changed(emu);                                                          \
 		} while (0))
 
 /* cpu_csrs_t : structure storing the current value of the CSRs
@@ -1,6 +1,7 @@
 #include <assert.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 #include <sys/mman.h>
 
 #include "cpu.h"
@@ -78,18 +79,45 @@ bool cpu_decode(uint32_t encoded_instruction, ins_t* decoded_instruction) {
 	return true;
 }
 
-bool cpu_decode_and_cache(emulator_t* emu, guest_vaddr instruction_addr, ins_t** decoded_instruction) {
+static void cpu_fuse_instructions(emulator_t* emu, guest_vaddr instruction_addr, cached_ins_t* cached_instruction) {
+	cached_instruction->fused_instruction.type = INS_TYPE_INVALID;
+
+	// The next instruction is only fetched if it's in the same page to avoid an extra translation
+	guest_vaddr next_addr = instruction_addr + 4;
+	if ((next_addr & MMU_VG2PG_OFFSET_MASK) == 0) {
+		return;
+	}
+
+	uint8_t exception_code;
+	guest_reg exception_tval;
+	uint32_t encoded_instruction = emu_r32_ins(emu, next_addr, &exception_code, &exception_tval);
+	ins_t next_instruction;
+	if (exception_code != (uint8_t)-1 || !cpu_decode(encoded_instruction, &next_instruction)) {
+		return;
+	}
+
+	cpu_handler_t fused_handler = cpu_resolve_fused_handler(cached_instruction->handler,
+								cpu_resolve_handler(&next_instruction));
+	if (fused_handler != NULL) {
+		cached_instruction->handler = fused_handler;
+		cached_instruction->fused_instruction = next_instruction;
+	}
+}
+
+bool cpu_decode_and_cache(emulator_t* emu, guest_vaddr instruction_addr, const cached_ins_t** cached_instruction_out) {
 	assert(!emu->cpu.dynarec_enabled);
 	assert((instruction_addr & 3) == 0);
 
 	size_t cache_index = (instruction_addr >> 2) & emu->cpu.instruction_cache_mask;
 	cached_ins_t* cached_instruction = &emu->cpu.instruction_cache.as_cached_ins[cache_index];
-	*decoded_instruction = &cached_instruction->decoded_instruction;
+	*cached_instruction_out = cached_instruction;
 
+	guest_vaddr tag = CPU_INSTRUCTION_CACHE_TAG(&emu->cpu, instruction_addr);
 	if (cached_instruction->decoded_instruction.type != INS_TYPE_INVALID &&
-	    cached_instruction->tag == instruction_addr) {
+	    cached_instruction->tag == tag) {
 		return true;
 	}
+	emu->cache_misses[EMU_CACHE_INSTRUCTION]++;
 
 	uint8_t exception_code;
 	guest_reg exception_tval;
@@ -102,29 +130,42 @@ bool cpu_decode_and_cache(emulator_t* emu, guest_vaddr instruction_addr, ins_t**
 		cached_instruction->decoded_instruction.type = INS_TYPE_INVALID;
 		return false;
 	}
-	cached_instruction->tag = instruction_addr;
+	cached_instruction->handler = cpu_resolve_handler(&cached_instruction->decoded_instruction);
+	cached_instruction->tag = tag;
+	cpu_fuse_instructions(emu, instruction_addr, cached_instruction);
 	return true;
 }
 
 bool cpu_invalidate_instruction_cache(emulator_t* emu, guest_vaddr addr) {
+	/* NOTE : the entries are invalidated regardless of the translation mode stored in their tag, we
+	 *        don't know in which mode the caller computed `addr`
+	 */
 #ifdef RISCV_EMULATOR_DYNAREC_X86_64_SUPPORT
 	if (emu->cpu.dynarec_enabled) {
 		size_t cache_index = (addr >> 2) & emu->cpu.instruction_cache_mask;
 		dr_ins_t* cached_instruction = &emu->cpu.instruction_cache.as_dr_ins[cache_index];
 
 		if (cached_instruction->native_code != NULL &&
-		    cached_instruction->tag == (addr & ~3)) {
+		    (cached_instruction->tag & ~3) == (addr & ~3)) {
+			/* Blocks in the hot region share their pages, the code is left in place until the
+			 * region is cleared
+			 */
+			bool hot = dr_is_hot_code(emu, cached_instruction->native_code);
 			uintptr_t page_base = (uintptr_t)cached_instruction->native_code & DYNAREC_PAGE_MASK;
-			munmap((void*)page_base, DYNAREC_PAGE_SIZE);
+			if (!hot) {
+				munmap((void*)page_base, DYNAREC_PAGE_SIZE);
+			}
 
-			guest_reg block_entry = cached_instruction->block_entry;
+			guest_reg block_entry = DR_INS_BLOCK_ENTRY(cached_instruction);
 			for (guest_reg pc = block_entry;; pc += 4) {
 				size_t index = (pc >> 2) & emu->cpu.instruction_cache_mask;
 				dr_ins_t* entry = &emu->cpu.instruction_cache.as_dr_ins[index];
-				if (entry->block_entry == block_entry &&
-				    ((uintptr_t)entry->native_code & DYNAREC_PAGE_MASK) == page_base) {
+				if (DR_INS_BLOCK_ENTRY(entry) == block_entry &&
+				    (hot ? dr_is_hot_code(emu, entry->native_code)
+					 : ((uintptr_t)entry->native_code & DYNAREC_PAGE_MASK) == page_base)) {
 					entry->native_code = NULL;
-					entry->tag = entry->block_entry = 0;
+					entry->tag = 0;
+					entry->block_offset = 0;
 				} else {
 					break;
 				}
@@ -138,15 +179,26 @@ bool cpu_invalidate_instruction_cache(emulator_t* emu, guest_vaddr addr) {
 	assert(!emu->cpu.dynarec_enabled);
 #endif
 
+	bool invalidated = false;
+
+	// A superinstruction starting at the previous instruction also contains this one
+	size_t previous_index = ((addr >> 2) - 1) & emu->cpu.instruction_cache_mask;
+	cached_ins_t* previous_instruction = &emu->cpu.instruction_cache.as_cached_ins[previous_index];
+	if (previous_instruction->decoded_instruction.type != INS_TYPE_INVALID &&
+	    previous_instruction->fused_instruction.type != INS_TYPE_INVALID &&
+	    (previous_instruction->tag & ~3) == (addr & ~3) - 4) {
+		previous_instruction->decoded_instruction.type = INS_TYPE_INVALID;
+		invalidated = true;
+	}
+
 	size_t cache_index = (addr >> 2) & emu->cpu.instruction_cache_mask;
 	cached_ins_t* cached_instruction = &emu->cpu.instruction_cache.as_cached_ins[cache_index];
 	if (cached_instruction->decoded_instruction.type != INS_TYPE_INVALID &&
-	    cached_instruction->tag == (addr & ~3)) {
+	    (cached_instruction->tag & ~3) == (addr & ~3)) {
 		cached_instruction->decoded_instruction.type = INS_TYPE_INVALID;
-		return true;
-	} else {
-		return false;
+		invalidated = true;
 	}
+	return invalidated;
 }
 
 void cpu_flush_instruction_cache(emulator_t* emu) {
@@ -161,16 +213,14 @@ void cpu_flush_instruction_cache(emulator_t* emu) {
 				cpu_invalidate_instruction_cache(emu, cached_instruction->tag);
 			}
 		}
+		memset(emu->cpu.dr_code_pages, 0, sizeof(emu->cpu.dr_code_pages));
+		dr_clear_hot_region(emu);
 		return;
 	}
 #else
 	assert(!emu->cpu.dynarec_enabled);
 #endif
 
-	for (size_t i = 0; i < instruction_cache_size; i++) {
-		cached_ins_t* cached_instruction = &emu->cpu.instruction_cache.as_cached_ins[i];
-		if (cached_instruction->decoded_instruction.type != INS_TYPE_INVALID) {
-			cpu_invalidate_instruction_cache(emu, cached_instruction->tag);
-		}
-	}
+	// NOTE : a zeroed entry has the type INS_TYPE_INVALID
+	emu_clear_cache(emu->cpu.instruction_cache.as_ptr, instruction_cache_size * sizeof(cached_ins_t));
 }
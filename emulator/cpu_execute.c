@@ -86,27 +86,165 @@ static inline guest_reg mulhu(guest_reg rs1, guest_reg rs2) {
 }
 #endif
 
-static void cpu_execute_type_r(emulator_t* emu, const ins_t* instruction) {
-	cpu_t* cpu = &emu->cpu;
-
-	guest_reg* rd = &cpu->regs[instruction->rd];
-	guest_reg* rs1 = &cpu->regs[instruction->rs1];
-	guest_reg* rs2 = &cpu->regs[instruction->rs2];
-	guest_word* rs1w = (guest_word*)((uint8_t*)&cpu->regs[instruction->rs1] + REG_WORD_OFFSET);
-	guest_word* rs2w = (guest_word*)((uint8_t*)&cpu->regs[instruction->rs2] + REG_WORD_OFFSET);
-
-	guest_reg_signed* rds = (guest_reg_signed*)&cpu->regs[instruction->rd];
-	guest_reg_signed* rs1s = (guest_reg_signed*)&cpu->regs[instruction->rs1];
-	guest_reg_signed* rs2s = (guest_reg_signed*)&cpu->regs[instruction->rs2];
-	guest_word_signed* rs1ws = (guest_word_signed*)((uint8_t*)&cpu->regs[instruction->rs1] + REG_WORD_OFFSET);
-	guest_word_signed* rs2ws = (guest_word_signed*)((uint8_t*)&cpu->regs[instruction->rs2] + REG_WORD_OFFSET);
-
-	switch (instruction->opcode_switch) {
-#define X_R(MNEMONIC, OPCODE, F3, F7, EXPR)             \
-	case ((OPCODE >> 2) | (F3 << 5) | (F7 << 8)): { \
-		EXPR;                                   \
-		break;                                  \
+/* CPU_EXECUTE_OPERANDS_X : macros declaring the variables available to the expression of an
+ *                          instruction (see X_INSTRUCTIONS in emulator/isa.h) for each type
+ */
+#define CPU_EXECUTE_OPERANDS_R                                                                                                  \
+	cpu_t* cpu = &emu->cpu;                                                                                                 \
+	__attribute__((unused)) guest_reg* rd = &cpu->regs[instruction->rd];                                                    \
+	__attribute__((unused)) guest_reg* rs1 = &cpu->regs[instruction->rs1];                                                  \
+	__attribute__((unused)) guest_reg* rs2 = &cpu->regs[instruction->rs2];                                                  \
+	__attribute__((unused)) guest_word* rs1w = (guest_word*)((uint8_t*)&cpu->regs[instruction->rs1] + REG_WORD_OFFSET);     \
+	__attribute__((unused)) guest_word* rs2w = (guest_word*)((uint8_t*)&cpu->regs[instruction->rs2] + REG_WORD_OFFSET);     \
+	__attribute__((unused)) guest_reg_signed* rds = (guest_reg_signed*)&cpu->regs[instruction->rd];                         \
+	__attribute__((unused)) guest_reg_signed* rs1s = (guest_reg_signed*)&cpu->regs[instruction->rs1];                       \
+	__attribute__((unused)) guest_reg_signed* rs2s = (guest_reg_signed*)&cpu->regs[instruction->rs2];                       \
+	__attribute__((unused)) guest_word_signed* rs1ws = (guest_word_signed*)((uint8_t*)&cpu->regs[instruction->rs1] +        \
+										REG_WORD_OFFSET);                               \
+	__attribute__((unused)) guest_word_signed* rs2ws = (guest_word_signed*)((uint8_t*)&cpu->regs[instruction->rs2] +        \
+										REG_WORD_OFFSET);
+
+#define CPU_EXECUTE_OPERANDS_I                                                                                              \
+	cpu_t* cpu = &emu->cpu;                                                                                             \
+	__attribute__((unused)) guest_reg* rd = &cpu->regs[instruction->rd];                                                \
+	__attribute__((unused)) guest_reg* rs1 = &cpu->regs[instruction->rs1];                                              \
+	__attribute__((unused)) guest_word* rs1w = (guest_word*)((uint8_t*)&cpu->regs[instruction->rs1] + REG_WORD_OFFSET); \
+	__attribute__((unused)) guest_reg_signed* rds = (guest_reg_signed*)&cpu->regs[instruction->rd];                     \
+	__attribute__((unused)) guest_reg_signed* rs1s = (guest_reg_signed*)&cpu->regs[instruction->rs1];                   \
+	__attribute__((unused)) guest_word_signed* rs1ws = (guest_word_signed*)((uint8_t*)&cpu->regs[instruction->rs1] +    \
+										REG_WORD_OFFSET);                           \
+	__attribute__((unused)) int64_t imm = instruction->imm;
+
+#define CPU_EXECUTE_OPERANDS_S                                                 \
+	cpu_t* cpu = &emu->cpu;                                                \
+	__attribute__((unused)) guest_reg* rs1 = &cpu->regs[instruction->rs1]; \
+	__attribute__((unused)) guest_reg* rs2 = &cpu->regs[instruction->rs2]; \
+	__attribute__((unused)) int64_t imm = instruction->imm;
+
+#define CPU_EXECUTE_OPERANDS_B                                                                            \
+	cpu_t* cpu = &emu->cpu;                                                                           \
+	__attribute__((unused)) guest_reg* rs1 = &cpu->regs[instruction->rs1];                            \
+	__attribute__((unused)) guest_reg* rs2 = &cpu->regs[instruction->rs2];                            \
+	__attribute__((unused)) guest_reg_signed* rs1s = (guest_reg_signed*)&cpu->regs[instruction->rs1]; \
+	__attribute__((unused)) guest_reg_signed* rs2s = (guest_reg_signed*)&cpu->regs[instruction->rs2]; \
+	__attribute__((unused)) int64_t imm = instruction->imm;
+
+#define CPU_EXECUTE_OPERANDS_U_J                                             \
+	cpu_t* cpu = &emu->cpu;                                              \
+	__attribute__((unused)) guest_reg* rd = &cpu->regs[instruction->rd]; \
+	__attribute__((unused)) int64_t imm = instruction->imm;
+
+/* NOTE : every instruction is implemented by its own handler, the handler is resolved once by
+ *        `cpu_resolve_handler` when the instruction is cached, the expression is wrapped in a loop to
+ *        allow BREAK_IF_EXCEPTION_PENDING
+ */
+#define X_R(MNEMONIC, OPCODE, F3, F7, EXPR)                                                \
+	static void cpu_execute_##MNEMONIC(emulator_t* emu, const ins_t* instruction) { \
+		CPU_EXECUTE_OPERANDS_R                                                     \
+		do {                                                                       \
+			EXPR;                                                              \
+		} while (0);                                                               \
 	}
+#define X_I(MNEMONIC, OPCODE, F3, EXPR)                                                    \
+	static void cpu_execute_##MNEMONIC(emulator_t* emu, const ins_t* instruction) { \
+		CPU_EXECUTE_OPERANDS_I                                                     \
+		do {                                                                       \
+			EXPR;                                                              \
+		} while (0);                                                               \
+	}
+#define X_I_IMM(MNEMONIC, OPCODE, F3, EXPR, F12S, F7S) X_I(MNEMONIC, OPCODE, F3, EXPR)
+#define X_S(MNEMONIC, OPCODE, F3, EXPR)                                                    \
+	static void cpu_execute_##MNEMONIC(emulator_t* emu, const ins_t* instruction) { \
+		CPU_EXECUTE_OPERANDS_S                                                     \
+		do {                                                                       \
+			EXPR;                                                              \
+		} while (0);                                                               \
+	}
+#define X_B(MNEMONIC, OPCODE, F3, EXPR)                                                    \
+	static void cpu_execute_##MNEMONIC(emulator_t* emu, const ins_t* instruction) { \
+		CPU_EXECUTE_OPERANDS_B                                                     \
+		do {                                                                       \
+			EXPR;                                                              \
+		} while (0);                                                               \
+	}
+#define X_U(MNEMONIC, OPCODE, EXPR)                                                        \
+	static void cpu_execute_##MNEMONIC(emulator_t* emu, const ins_t* instruction) { \
+		CPU_EXECUTE_OPERANDS_U_J                                                   \
+		do {                                                                       \
+			EXPR;                                                              \
+		} while (0);                                                               \
+	}
+#define X_J(MNEMONIC, OPCODE, EXPR) X_U(MNEMONIC, OPCODE, EXPR)
+
+X_INSTRUCTIONS
+
+#undef X_R
+#undef X_I
+#undef X_I_IMM
+#undef X_S
+#undef X_B
+#undef X_U
+#undef X_J
+
+static void cpu_execute_illegal(emulator_t* emu, const ins_t* instruction) {
+	(void)instruction;
+	cpu_throw_exception(emu, EXC_ILL_INS, 0);
+}
+
+/* X_FUSED_PAIRS : X-macro storing the pairs of consecutive instructions executed by a single
+ *                 superinstruction, they are the most frequent pairs emitted by compilers for
+ *                 constants, addresses, calls, loop tails and register spills
+ *     X_FUSED(FIRST, SECOND) : pair of instructions, FIRST should never jump
+ */
+#define X_FUSED_PAIRS           \
+	X_FUSED(LUI, ADDI)      \
+	X_FUSED(LUI, ADDIW)     \
+	X_FUSED(AUIPC, ADDI)    \
+	X_FUSED(AUIPC, JALR)    \
+	X_FUSED(ADDI, BNE)      \
+	X_FUSED(SLLI, ADD)      \
+	X_FUSED(LD, LD)         \
+	X_FUSED(SD, SD)
+
+/* NOTE : the first instruction is executed as the last instruction of a basic block would be, the
+ *        PC is left to the second one so it can throw an exception or jump as usual
+ */
+#define X_FUSED(FIRST, SECOND)                                                                      \
+	static void cpu_execute_##FIRST##_##SECOND(emulator_t* emu, const ins_t* instruction) {     \
+		cpu_execute_##FIRST(emu, &instruction[0]);                                          \
+		if (emu->cpu.exception_pending) {                                                   \
+			return;                                                                     \
+		}                                                                                   \
+		emu->cpu.regs[0] = 0;                                                               \
+		emu->cpu.pc += 4;                                                                   \
+		cpu_execute_##SECOND(emu, &instruction[1]);                                         \
+	}
+
+X_FUSED_PAIRS
+
+#undef X_FUSED
+
+cpu_handler_t cpu_resolve_fused_handler(cpu_handler_t first, cpu_handler_t second) {
+#define X_FUSED(FIRST, SECOND)                                                        \
+	if (first == &cpu_execute_##FIRST && second == &cpu_execute_##SECOND) {       \
+		return &cpu_execute_##FIRST##_##SECOND;                               \
+	}
+
+	X_FUSED_PAIRS
+
+#undef X_FUSED
+	return NULL;
+}
+
+cpu_handler_t cpu_resolve_handler(const ins_t* instruction) {
+	int64_t imm = instruction->imm;
+
+	switch (instruction->type) {
+		case INS_TYPE_R:
+			switch (instruction->opcode_switch) {
+#define X_R(MNEMONIC, OPCODE, F3, F7, EXPR)           \
+	case ((OPCODE >> 2) | (F3 << 5) | (F7 << 8)): \
+		return &cpu_execute_##MNEMONIC;
 #define X_I(MNEMONIC, OPCODE, F3, EXPR)
 #define X_I_IMM(MNEMONIC, OPCODE, F3, EXPR, F12S, F7S)
 #define X_S(MNEMONIC, OPCODE, F3, EXPR)
@@ -114,7 +252,7 @@ static void cpu_execute_type_r(emulator_t* emu, const ins_t* instruction) {
 #define X_U(MNEMONIC, OPCODE, EXPR)
 #define X_J(MNEMONIC, OPCODE, EXPR)
 
-		X_INSTRUCTIONS
+				X_INSTRUCTIONS
 
 #undef X_R
 #undef X_I
@@ -123,60 +261,38 @@ static void cpu_execute_type_r(emulator_t* emu, const ins_t* instruction) {
 #undef X_B
 #undef X_U
 #undef X_J
-		default:
-			cpu_throw_exception(emu, EXC_ILL_INS, 0);
+			}
 			break;
-	}
-}
-
-static void cpu_execute_type_i(emulator_t* emu, const ins_t* instruction) {
-	cpu_t* cpu = &emu->cpu;
-
-	guest_reg* rd = &cpu->regs[instruction->rd];
-	guest_reg* rs1 = &cpu->regs[instruction->rs1];
-	guest_word* rs1w = (guest_word*)((uint8_t*)&cpu->regs[instruction->rs1] + REG_WORD_OFFSET);
 
-	guest_reg_signed* rds = (guest_reg_signed*)&cpu->regs[instruction->rd];
-	guest_reg_signed* rs1s = (guest_reg_signed*)&cpu->regs[instruction->rs1];
-	guest_word_signed* rs1ws = (guest_word_signed*)((uint8_t*)&cpu->regs[instruction->rs1] + REG_WORD_OFFSET);
-
-	int64_t imm = instruction->imm;
-
-	switch (instruction->opcode_switch) {
+		case INS_TYPE_I:
+			switch (instruction->opcode_switch) {
 #define X_R(MNEMONIC, OPCODE, F3, F7, EXPR)
-#define X_I(MNEMONIC, OPCODE, F3, EXPR)     \
-	case ((OPCODE >> 2) | (F3 << 5)): { \
-		EXPR;                       \
-		break;                      \
-	}
+#define X_I(MNEMONIC, OPCODE, F3, EXPR) \
+	case ((OPCODE >> 2) | (F3 << 5)):   \
+		return &cpu_execute_##MNEMONIC;
 #define T(...) __VA_ARGS__
-#define X_I_IMM(MNEMONIC, OPCODE, F3, EXPR, F12S, F7S)                                  \
-	case ((OPCODE >> 2) | (F3 << 5)): {                                             \
-		int64_t f12s[] = {F12S}, f7s[] = {F7S};                                 \
-		bool found = false;                                                     \
-		for (size_t i = 0; i < sizeof(f12s) / sizeof(f12s[0]) && !found; i++) { \
-			if (f12s[i] == imm) {                                           \
-				found = true;                                           \
-			}                                                               \
-		}                                                                       \
-		for (size_t i = 0; i < sizeof(f7s) / sizeof(f7s[0]) && !found; i++) {   \
-			if ((f7s[i] << 5) == (imm & 0xfe0)) {                           \
-				found = true;                                           \
-			}                                                               \
-		}                                                                       \
-		if (!found) {                                                           \
-			cpu_throw_exception(emu, EXC_ILL_INS, 0);                       \
-			break;                                                          \
-		}                                                                       \
-		EXPR;                                                                   \
-		break;                                                                  \
+// NOTE : the immediate is validated once here instead of on each execution
+#define X_I_IMM(MNEMONIC, OPCODE, F3, EXPR, F12S, F7S)                          \
+	case ((OPCODE >> 2) | (F3 << 5)): {                                     \
+		int64_t f12s[] = {F12S}, f7s[] = {F7S};                         \
+		for (size_t i = 0; i < sizeof(f12s) / sizeof(f12s[0]); i++) {   \
+			if (f12s[i] == imm) {                                   \
+				return &cpu_execute_##MNEMONIC;                 \
+			}                                                       \
+		}                                                               \
+		for (size_t i = 0; i < sizeof(f7s) / sizeof(f7s[0]); i++) {     \
+			if ((f7s[i] << 5) == (imm & 0xfe0)) {                   \
+				return &cpu_execute_##MNEMONIC;                 \
+			}                                                       \
+		}                                                               \
+		return &cpu_execute_illegal;                                    \
 	}
 #define X_S(MNEMONIC, OPCODE, F3, EXPR)
 #define X_B(MNEMONIC, OPCODE, F3, EXPR)
 #define X_U(MNEMONIC, OPCODE, EXPR)
 #define X_J(MNEMONIC, OPCODE, EXPR)
 
-		X_INSTRUCTIONS
+				X_INSTRUCTIONS
 
 #undef X_R
 #undef X_I
@@ -186,33 +302,22 @@ static void cpu_execute_type_i(emulator_t* emu, const ins_t* instruction) {
 #undef X_B
 #undef X_U
 #undef X_J
-		default:
-			cpu_throw_exception(emu, EXC_ILL_INS, 0);
+			}
 			break;
-	}
-}
 
-static void cpu_execute_type_s(emulator_t* emu, const ins_t* instruction) {
-	cpu_t* cpu = &emu->cpu;
-
-	guest_reg* rs1 = &cpu->regs[instruction->rs1];
-	guest_reg* rs2 = &cpu->regs[instruction->rs2];
-	int64_t imm = instruction->imm;
-
-	switch (instruction->opcode_switch) {
+		case INS_TYPE_S:
+			switch (instruction->opcode_switch) {
 #define X_R(MNEMONIC, OPCODE, F3, F7, EXPR)
 #define X_I(MNEMONIC, OPCODE, F3, EXPR)
 #define X_I_IMM(MNEMONIC, OPCODE, F3, EXPR, F12S, F7S)
-#define X_S(MNEMONIC, OPCODE, F3, EXPR)     \
-	case ((OPCODE >> 2) | (F3 << 5)): { \
-		EXPR;                       \
-		break;                      \
-	}
+#define X_S(MNEMONIC, OPCODE, F3, EXPR) \
+	case ((OPCODE >> 2) | (F3 << 5)):   \
+		return &cpu_execute_##MNEMONIC;
 #define X_B(MNEMONIC, OPCODE, F3, EXPR)
 #define X_U(MNEMONIC, OPCODE, EXPR)
 #define X_J(MNEMONIC, OPCODE, EXPR)
 
-		X_INSTRUCTIONS
+				X_INSTRUCTIONS
 
 #undef X_R
 #undef X_I
@@ -221,37 +326,22 @@ static void cpu_execute_type_s(emulator_t* emu, const ins_t* instruction) {
 #undef X_B
 #undef X_U
 #undef X_J
-		default:
-			cpu_throw_exception(emu, EXC_ILL_INS, 0);
+			}
 			break;
-	}
-}
-
-static void cpu_execute_type_b(emulator_t* emu, const ins_t* instruction) {
-	cpu_t* cpu = &emu->cpu;
-
-	guest_reg* rs1 = &cpu->regs[instruction->rs1];
-	guest_reg* rs2 = &cpu->regs[instruction->rs2];
-
-	guest_reg_signed* rs1s = (guest_reg_signed*)&cpu->regs[instruction->rs1];
-	guest_reg_signed* rs2s = (guest_reg_signed*)&cpu->regs[instruction->rs2];
-
-	int64_t imm = instruction->imm;
 
-	switch (instruction->opcode_switch) {
+		case INS_TYPE_B:
+			switch (instruction->opcode_switch) {
 #define X_R(MNEMONIC, OPCODE, F3, F7, EXPR)
 #define X_I(MNEMONIC, OPCODE, F3, EXPR)
 #define X_I_IMM(MNEMONIC, OPCODE, F3, EXPR, F12S, F7S)
 #define X_S(MNEMONIC, OPCODE, F3, EXPR)
-#define X_B(MNEMONIC, OPCODE, F3, EXPR)     \
-	case ((OPCODE >> 2) | (F3 << 5)): { \
-		EXPR;                       \
-		break;                      \
-	}
+#define X_B(MNEMONIC, OPCODE, F3, EXPR) \
+	case ((OPCODE >> 2) | (F3 << 5)):   \
+		return &cpu_execute_##MNEMONIC;
 #define X_U(MNEMONIC, OPCODE, EXPR)
 #define X_J(MNEMONIC, OPCODE, EXPR)
 
-		X_INSTRUCTIONS
+				X_INSTRUCTIONS
 
 #undef X_R
 #undef X_I
@@ -260,32 +350,22 @@ static void cpu_execute_type_b(emulator_t* emu, const ins_t* instruction) {
 #undef X_B
 #undef X_U
 #undef X_J
-		default:
-			cpu_throw_exception(emu, EXC_ILL_INS, 0);
+			}
 			break;
-	}
-}
-
-static void cpu_execute_type_u(emulator_t* emu, const ins_t* instruction) {
-	cpu_t* cpu = &emu->cpu;
 
-	guest_reg* rd = &cpu->regs[instruction->rd];
-	int64_t imm = instruction->imm;
-
-	switch (instruction->opcode_switch) {
+		case INS_TYPE_U:
+			switch (instruction->opcode_switch) {
 #define X_R(MNEMONIC, OPCODE, F3, F7, EXPR)
 #define X_I(MNEMONIC, OPCODE, F3, EXPR)
 #define X_I_IMM(MNEMONIC, OPCODE, F3, EXPR, F12S, F7S)
 #define X_S(MNEMONIC, OPCODE, F3, EXPR)
 #define X_B(MNEMONIC, OPCODE, F3, EXPR)
 #define X_U(MNEMONIC, OPCODE, EXPR) \
-	case (OPCODE >> 2): {       \
-		EXPR;               \
-		break;              \
-	}
+	case (OPCODE >> 2):         \
+		return &cpu_execute_##MNEMONIC;
 #define X_J(MNEMONIC, OPCODE, EXPR)
 
-		X_INSTRUCTIONS
+				X_INSTRUCTIONS
 
 #undef X_R
 #undef X_I
@@ -294,28 +374,19 @@ static void cpu_execute_type_u(emulator_t* emu, const ins_t* instruction) {
 #undef X_B
 #undef X_U
 #undef X_J
-
-		default:
-			cpu_throw_exception(emu, EXC_ILL_INS, 0);
+			}
 			break;
-	}
-}
-
-static void cpu_execute_type_j(emulator_t* emu, const ins_t* instruction) {
-	cpu_t* cpu = &emu->cpu;
-
-	guest_reg* rd = &cpu->regs[instruction->rd];
-	int64_t imm = instruction->imm;
 
+		case INS_TYPE_J:
 #define X_R(MNEMONIC, OPCODE, F3, F7, EXPR)
 #define X_I(MNEMONIC, OPCODE, F3, EXPR)
 #define X_I_IMM(MNEMONIC, OPCODE, F3, EXPR, F12S, F7S)
 #define X_S(MNEMONIC, OPCODE, F3, EXPR)
 #define X_B(MNEMONIC, OPCODE, F3, EXPR)
 #define X_U(MNEMONIC, OPCODE, EXPR)
-#define X_J(MNEMONIC, OPCODE, EXPR) EXPR;
+#define X_J(MNEMONIC, OPCODE, EXPR) return &cpu_execute_##MNEMONIC;
 
-	X_INSTRUCTIONS
+			X_INSTRUCTIONS
 
 #undef X_R
 #undef X_I
@@ -324,105 +395,180 @@ static void cpu_execute_type_j(emulator_t* emu, const ins_t* instruction) {
 #undef X_B
 #undef X_U
 #undef X_J
+
+		default:
+			// TODO : better diag system
+			fprintf(stderr, "Internal emulator error : invalid instruction type\n");
+			abort();
+			break;
+	}
+
+	return &cpu_execute_illegal;
 }
 
 #ifdef RISCV_EMULATOR_DYNAREC_X86_64_SUPPORT
-static void cpu_execute_dynarec(emulator_t* emu) {
+static uint64_t cpu_execute_dynarec(emulator_t* emu, uint64_t max_instructions) {
 	assert(emu->cpu.dynarec_enabled);
 	assert((emu->cpu.pc & 3) == 0);
 
 	size_t cache_index = (emu->cpu.pc >> 2) & emu->cpu.instruction_cache_mask;
 	dr_ins_t* cached_instruction = &emu->cpu.instruction_cache.as_dr_ins[cache_index];
-	if (cached_instruction->tag != emu->cpu.pc || cached_instruction->native_code == NULL) {
+	guest_vaddr tag = CPU_INSTRUCTION_CACHE_TAG(&emu->cpu, emu->cpu.pc);
+	if (cached_instruction->tag != tag || cached_instruction->native_code == NULL) {
+		emu->cache_misses[EMU_CACHE_INSTRUCTION]++;
 		if (!dr_emit_block(emu, emu->cpu.pc)) {
 			if (!emu->cpu.exception_pending) {
 				cpu_throw_exception(emu, EXC_ILL_INS, 0);
 			}
-			return;
+			return 0;
 		}
 	}
-	assert(cached_instruction->tag == emu->cpu.pc);
+	assert(cached_instruction->tag == tag);
+
+	if (cached_instruction->hits < DYNAREC_HOT_THRESHOLD &&
+	    ++cached_instruction->hits == DYNAREC_HOT_THRESHOLD) {
+		bool emitted = dr_emit_hot_block(emu, emu->cpu.pc);
+		if (!emitted && !emu->cpu.exception_pending) {
+			// The previous block was already invalidated, we fall back to a regular block
+			emitted = dr_emit_block(emu, emu->cpu.pc);
+		}
+		if (!emitted) {
+			if (!emu->cpu.exception_pending) {
+				cpu_throw_exception(emu, EXC_ILL_INS, 0);
+			}
+			return 0;
+		}
+		assert(cached_instruction->tag == tag);
+	}
 
 	assert(emu->cpu.regs[0] == 0);
 
-	emu->cpu.pc = dr_entry(emu, cached_instruction->native_code,
-			       emu->cpu.regs, emu->cpu.pc);
-}
-#endif
-
-void cpu_execute(emulator_t* emu) {
-	/* The `exception_pending` flag is kept to true when an exception occured during the
-	 * *current* instruction, we clean it on each new `cpu_execute`
-	 */
-	emu->cpu.exception_pending = false;
-	emu->cpu.jump_pending = false;
-	emu->cpu.tlb_or_cache_flush_pending = false;
-
-	if ((emu->cpu.pc & 0x3) != 0) {
-		cpu_throw_exception(emu, EXC_INS_ADDR_MISALIGNED, emu->cpu.pc);
-		return;
+	// Spin-wait loops are detected by `dr_idiom_execute` when they keep jumping back to their head
+	if (emu->cpu.pc == emu->cpu.dr_last_entry) {
+		emu->cpu.dr_self_loops++;
+	} else {
+		emu->cpu.dr_last_entry = emu->cpu.pc;
+		emu->cpu.dr_self_loops = 0;
 	}
 
-	if ((emu->device_update_iter & emu->device_update_iter_mask) == 0) {
-		emu_update_mmio_devices(emu);
+	guest_vaddr entry_pc = emu->cpu.pc;
+	emu->cpu.dr_idiom_budget = max_instructions;
+	emu->cpu.dr_idiom_retired = 0;
+	dr_exit_t exit = dr_entry(emu, cached_instruction->native_code,
+				  emu->cpu.regs, emu->cpu.pc, emu->cpu.dr_page_cache);
+	emu->cpu.pc = exit.pc;
+
+	/* The instructions of a block are executed in sequence up to the one leaving it, which isn't
+	 * retired if it threw an exception
+	 */
+	uint64_t retired;
+	if (exit.exit_pc == DR_NO_EXIT_INSTRUCTION) {
+		retired = (exit.pc - entry_pc) / 4;
+	} else {
+		retired = (exit.exit_pc - entry_pc) / 4 + !emu->cpu.exception_pending;
 	}
-	emu->device_update_iter++;
-	cpu_check_interrupt(emu);
+	return retired + emu->cpu.dr_idiom_retired;
+}
+#endif
 
+static uint64_t cpu_execute_block(emulator_t* emu, uint64_t max_instructions) {
 #ifdef RISCV_EMULATOR_DYNAREC_X86_64_SUPPORT
 	if (emu->cpu.dynarec_enabled) {
-		cpu_execute_dynarec(emu);
-		return;
+		return cpu_execute_dynarec(emu, max_instructions);
 	}
 #else
 	assert(!emu->cpu.dynarec_enabled);
 #endif
 
-	ins_t* instruction;
-	if (!cpu_decode_and_cache(emu, emu->cpu.pc, &instruction)) {
-		if (!emu->cpu.exception_pending) {
-			cpu_throw_exception(emu, EXC_ILL_INS, 0);
-		}
-		return;
+	/* The interpreter executes a whole basic block : the checks of `cpu_execute` are only done at its
+	 * boundaries, i.e. after a jump, an exception or a SYSTEM or MISC-MEM instruction which
+	 * might change the state of the CPU
+	 */
+	if (max_instructions > CPU_INTERPRETER_BLOCK_MAX_INSTRUCTIONS) {
+		max_instructions = CPU_INTERPRETER_BLOCK_MAX_INSTRUCTIONS;
 	}
+	uint64_t retired = 0;
+	while (retired < max_instructions && emu->running) {
+		const cached_ins_t* instruction;
+		if (!cpu_decode_and_cache(emu, emu->cpu.pc, &instruction)) {
+			/* We don't throw an exception if we're not at the beginning of the block as the
+			 * instruction might not be executed (e.g. the end of the code in simple mode)
+			 */
+			if (!emu->cpu.exception_pending && retired == 0) {
+				cpu_throw_exception(emu, EXC_ILL_INS, 0);
+			}
+			return retired;
+		}
 
-	// We check for x0: see the comment before clearing x0 at the end of the function
-	assert(emu->cpu.regs[0] == 0);
+		// We check for x0: see the comment before clearing x0 at the end of the loop
+		assert(emu->cpu.regs[0] == 0);
+
+		guest_vaddr instruction_pc = emu->cpu.pc;
+		bool fused = instruction->fused_instruction.type != INS_TYPE_INVALID;
+		if (fused && max_instructions - retired < 2) {
+			// The budget ends in the middle of the superinstruction, we only execute its first instruction
+			cpu_resolve_handler(&instruction->decoded_instruction)(emu, &instruction->decoded_instruction);
+			fused = false;
+		} else {
+			instruction->handler(emu, &instruction->decoded_instruction);
+		}
 
-	switch (instruction->type) {
-		case INS_TYPE_R:
-			cpu_execute_type_r(emu, instruction);
-			break;
-		case INS_TYPE_I:
-			cpu_execute_type_i(emu, instruction);
-			break;
-		case INS_TYPE_S:
-			cpu_execute_type_s(emu, instruction);
-			break;
-		case INS_TYPE_B:
-			cpu_execute_type_b(emu, instruction);
-			break;
-		case INS_TYPE_U:
-			cpu_execute_type_u(emu, instruction);
-			break;
-		case INS_TYPE_J:
-			cpu_execute_type_j(emu, instruction);
+		if (!(emu->cpu.jump_pending || emu->cpu.exception_pending)) {
+			emu->cpu.pc += 4;
+		}
+
+		/* zero (i.e. x0) is always set to 0 in RISC-V, some previous instructions might
+		 * have tampered with this register for the sake of simplifying the emulation control
+		 * flow
+		 * (e.g. `j addr` == `jal x0, addr` might have set x0 to PC+4)
+		 */
+		emu->cpu.regs[0] = 0;
+
+		if (emu->cpu.exception_pending) {
+			/* The instruction throwing the exception isn't retired, but the first instruction of a
+			 * superinstruction was if the exception was thrown by the second one
+			 */
+			guest_reg epc = emu->cpu.priv_mode == S_MODE ? emu->cpu.csrs.sepc : emu->cpu.csrs.mepc;
+			if (fused && epc == instruction_pc + 4) {
+				retired++;
+			}
 			break;
-		default:
-			// TODO : better diag system
-			fprintf(stderr, "Internal emulator error : invalid instruction type\n");
-			abort();
+		}
+		retired += fused ? 2 : 1;
+
+		uint8_t opcode = instruction->decoded_instruction.opcode_switch & 0x1f;
+		if (emu->cpu.jump_pending || emu->cpu.tlb_or_cache_flush_pending ||
+		    opcode == (OPCODE_SYSTEM >> 2) || opcode == (OPCODE_MISC_MEM >> 2)) {
 			break;
+		}
 	}
+	return retired;
+}
 
-	if (!(emu->cpu.jump_pending || emu->cpu.exception_pending)) {
-		emu->cpu.pc += 4;
+uint64_t cpu_execute(emulator_t* emu, uint64_t max_instructions) {
+	/* The `exception_pending` flag is kept to true when an exception occured during the
+	 * *current* instruction, we clean it on each new `cpu_execute`
+	 */
+	emu->cpu.exception_pending = false;
+	emu->cpu.jump_pending = false;
+	emu->cpu.tlb_or_cache_flush_pending = false;
+
+	if ((emu->cpu.pc & 0x3) != 0) {
+		cpu_throw_exception(emu, EXC_INS_ADDR_MISALIGNED, emu->cpu.pc);
+		return 0;
 	}
 
-	/* zero (i.e. x0) is always set to 0 in RISC-V, some previous instructions might
-	 * have tampered with this register for the sake of simplifying the emulation control
-	 * flow
-	 * (e.g. `j addr` == `jal x0, addr` might have set x0 to PC+4)
-	 */
-	emu->cpu.regs[0] = 0;
+	if (emu->device_update_countdown == 0) {
+		emu_update_mmio_devices(emu);
+		emu->device_update_countdown = emu->device_update_period;
+	}
+	if (emu->cpu.interrupt_deliverable) {
+		cpu_check_interrupt(emu);
+	}
+
+	// NOTE : the block stops at the next device update, a dynarec block might still go past it
+	uint64_t countdown = emu->device_update_countdown;
+	uint64_t retired = cpu_execute_block(emu, max_instructions < countdown ? max_instructions : countdown);
+	emu->device_update_countdown -= retired < countdown ? retired : countdown;
+	return retired;
 }
@@ -29,6 +29,8 @@ void cpu_throw_exception(emulator_t* emu, uint8_t exception_code, guest_reg tval
 					((spie & 1) << 5) |                // SPIE
 					(0 << 1);                          // SIE
 		emu->cpu.priv_mode = S_MODE;
+		mmu_vg2pg_context_changed(emu);
+		cpu_update_interrupt_deliverable(emu);
 
 		// Even in vectored mode, exceptions set PC to the base of xtvec
 		emu->cpu.pc = (emu->cpu.csrs.stvec) & ~3;
@@ -43,6 +45,8 @@ void cpu_throw_exception(emulator_t* emu, uint8_t exception_code, guest_reg tval
 					((mpie & 1) << 7) |                 // MPIE
 					(0 << 3);                           // MIE
 		emu->cpu.priv_mode = M_MODE;
+		mmu_vg2pg_context_changed(emu);
+		cpu_update_interrupt_deliverable(emu);
 
 		// Even in vectored mode, exceptions set PC to the base of xtvec
 		emu->cpu.pc = (emu->cpu.csrs.mtvec) & ~3;
@@ -68,6 +72,8 @@ void cpu_mret(emulator_t* emu) {
 	if (mpp != M_MODE) {
 		emu->cpu.csrs.mstatus &= ~(1 << 17);  // MPRV
 	}
+	mmu_vg2pg_context_changed(emu);
+	cpu_update_interrupt_deliverable(emu);
 
 	emu->cpu.pc = emu->cpu.csrs.mepc;
 	emu->cpu.jump_pending = true;
@@ -89,6 +95,8 @@ void cpu_sret(emulator_t* emu) {
 				(1 << 5) |             // SPIE
 				((spie & 1) << 1);     // SIE
 	emu->cpu.priv_mode = spp;
+	mmu_vg2pg_context_changed(emu);
+	cpu_update_interrupt_deliverable(emu);
 
 	emu->cpu.pc = emu->cpu.csrs.sepc;
 	emu->cpu.jump_pending = true;
@@ -101,7 +109,12 @@ void cpu_wfi(emulator_t* emu) {
 		return;
 	}
 
-	// TODO : Implement a select(2) based WFI, for now this is a nop which is really inefficient
+	/* NOTE : WFI resumes when any interrupt enabled in mie is pending, regardless of the
+	 *        global interrupt enable bits, the interrupt itself is taken by the next `cpu_execute`
+	 */
+	if ((emu->cpu.csrs.mip & emu->cpu.csrs.mie) == 0) {
+		emu_idle(emu, EMU_IDLE_MAX_WAIT_NS);
+	}
 }
 
 static bool cpu_throw_interrupt(emulator_t* emu, size_t interrupt) {
@@ -130,6 +143,8 @@ static bool cpu_throw_interrupt(emulator_t* emu, size_t interrupt) {
 					((sie & 1) << 5) |        // SPIE
 					(0 << 1);                 // SIE
 		emu->cpu.priv_mode = S_MODE;
+		mmu_vg2pg_context_changed(emu);
+		cpu_update_interrupt_deliverable(emu);
 
 		emu->cpu.pc = (emu->cpu.csrs.stvec) & ~3;
 		if (emu->cpu.csrs.stvec & 1) {
@@ -147,6 +162,8 @@ static bool cpu_throw_interrupt(emulator_t* emu, size_t interrupt) {
 					((mie & 1) << 7) |         // MPIE
 					(0 << 3);                  // MIE
 		emu->cpu.priv_mode = M_MODE;
+		mmu_vg2pg_context_changed(emu);
+		cpu_update_interrupt_deliverable(emu);
 
 		emu->cpu.pc = (emu->cpu.csrs.mtvec) & ~3;
 		if (emu->cpu.csrs.mtvec & 1) {
@@ -166,4 +183,26 @@ void cpu_check_interrupt(emulator_t* emu) {
 			}
 		}
 	}
+
+	// The summary may be outdated if a bit was cleared in mip, nothing will be thrown until it's set again
+	emu->cpu.interrupt_deliverable = false;
+}
+
+void cpu_update_interrupt_deliverable(emulator_t* emu) {
+	guest_reg pending = emu->cpu.csrs.mip & 0xfff;
+	if (emu->cpu.priv_mode == UO_MODE) {
+		// Any pending interrupt is uncaught and stops the emulator
+		emu->cpu.interrupt_deliverable = pending != 0;
+		return;
+	}
+
+	pending &= emu->cpu.csrs.mie;
+	bool sie = (emu->cpu.csrs.mstatus >> 1) & 1;
+	bool mie = (emu->cpu.csrs.mstatus >> 3) & 1;
+	privilege_mode_t priv_mode = emu->cpu.priv_mode;
+	bool m_enabled = (priv_mode == M_MODE && mie) || (priv_mode < M_MODE);
+	bool s_enabled = (priv_mode == S_MODE && sie) || (priv_mode < S_MODE);
+
+	emu->cpu.interrupt_deliverable = ((pending & ~emu->cpu.csrs.mideleg) && m_enabled) ||
+					 ((pending & emu->cpu.csrs.mideleg) && s_enabled);
 }
@@ -31,9 +31,17 @@ void cpu_sret(emulator_t* emu);
  */
 void cpu_wfi(emulator_t* emu);
 
-/* cpu_check_interrupt : check if an interrupt should be thrown and throw it if required
+/* cpu_check_interrupt : check if an interrupt should be thrown and throw it if required, the caller
+ *                       should only call it when `interrupt_deliverable` is set
  *     emulator_t* emu : pointer to the emulator
  */
 void cpu_check_interrupt(emulator_t* emu);
 
+/* cpu_update_interrupt_deliverable : update the summary telling if an interrupt might be thrown, it
+ *                                    should be called when a bit is set in mip or when mie, mideleg,
+ *                                    mstatus or the privilege mode change
+ *     emulator_t* emu : pointer to the emulator
+ */
+void cpu_update_interrupt_deliverable(emulator_t* emu);
+
 #endif
@@ -33,6 +33,7 @@ uint64_t clint_get_mtime(const clint_t* clint) {
 static inline void clint_update_mtip(emulator_t* emu, clint_t* clint) {
 	if (clint->mtimecmp <= clint_get_mtime(clint)) {
 		emu->cpu.csrs.mip |= (1 << 7);  // MTIP
+		cpu_update_interrupt_deliverable(emu);
 	} else {
 		emu->cpu.csrs.mip &= ~(1 << 7);  // MTIP
 	}
@@ -100,6 +101,7 @@ static void clint_w32(emulator_t* emu, void* device_data, guest_paddr addr, uint
 	if (addr == CLINT_MSWI_BASE) {
 		emu->cpu.csrs.mip = (emu->cpu.csrs.mip & ~(1 << 3)) |  // MSIP
 				    ((value & 1) << 3);
+		cpu_update_interrupt_deliverable(emu);
 	} else {
 		cpu_throw_exception(emu, EXC_STORE_ACCESS_FAULT, clint->base + addr);
 	}
@@ -123,6 +125,21 @@ static void clint_update(emulator_t* emu, void* device_data) {
 	clint_update_mtip(emu, clint);
 }
 
+static uint64_t clint_idle(emulator_t* emu, void* device_data, int* wake_fd) {
+	(void)wake_fd;
+
+	clint_t* clint = (clint_t*)device_data;
+	uint64_t mtime = clint_get_mtime(clint);
+	if (clint->mtimecmp <= mtime) {
+		// The timer interrupt only needs an update if it isn't already pending
+		return ((emu->cpu.csrs.mip >> 7) & 1) /* MTIP */ ? UINT64_MAX : 0;
+	} else if ((clint->mtimecmp - mtime) > UINT64_MAX / CLINT_TICK_PER_NS) {
+		return UINT64_MAX;
+	} else {
+		return (clint->mtimecmp - mtime) * CLINT_TICK_PER_NS;
+	}
+}
+
 bool clint_create(emulator_t* emu, guest_paddr base) {
 	clint_t* clint = malloc(sizeof(clint_t));
 	clint->monotonic_base = clint_get_monotonic_ticks();
@@ -133,6 +150,7 @@ bool clint_create(emulator_t* emu, guest_paddr base) {
 		clint,
 		clint_free,
 		clint_update,
+		clint_idle,
 		clint_r8,
 		clint_r16,
 		clint_r32,
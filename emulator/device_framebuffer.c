@@ -7,6 +7,8 @@
 #include "emulator.h"
 #include "emulator_sdl.h"
 
+#define FRAMEBUFFER_IDLE_PERIOD_NS 10000000  // 10ms
+
 static void framebuffer_free(emulator_t* emu, void* device_data) {
 	(void)emu;
 
@@ -18,6 +20,15 @@ static void framebuffer_update(emulator_t* emu, void* device_data) {
 	emu_sdl_draw(emu, *framebuffer_base);
 }
 
+static uint64_t framebuffer_idle(emulator_t* emu, void* device_data, int* wake_fd) {
+	(void)emu;
+	(void)device_data;
+	(void)wake_fd;
+
+	// NOTE : the SDL events are only polled on updates, we keep the window responsive while idle
+	return FRAMEBUFFER_IDLE_PERIOD_NS;
+}
+
 bool framebuffer_create(emulator_t* emu, guest_paddr base, int width, int height) {
 	guest_paddr* framebuffer_base = malloc(sizeof(guest_paddr));
 	assert(framebuffer_base != NULL);
@@ -36,9 +47,10 @@ bool framebuffer_create(emulator_t* emu, guest_paddr base, int width, int height
 		.device_data = framebuffer_base,
 		.free_handler = framebuffer_free,
 		.update_handler = framebuffer_update,
+		.idle_handler = framebuffer_idle,
 	};
 
-	if (!emu_map_memory(emu, base, framebuffer_size) ||
+	if (!emu_map_memory(emu, base, framebuffer_size, EMU_HUGE_PAGES_NONE, EMU_DEDUP_NONE) ||
 	    !emu_add_mmio_device(emu, base, 0, &device)) {
 		free(framebuffer_base);
 		return false;
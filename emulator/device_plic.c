@@ -160,6 +160,7 @@ static void plic_update(emulator_t* emu, void* device_data) {
 			    plic->claim_ctx_0 == 0) {
 				plic->claim_ctx_0 = i;
 				emu->cpu.csrs.mip |= (1 << 11);  // MEIP
+				cpu_update_interrupt_deliverable(emu);
 			}
 
 			if (((plic->enable_ctx_1[u32_index] >> bit_index) & 1) &&
@@ -167,6 +168,7 @@ static void plic_update(emulator_t* emu, void* device_data) {
 			    plic->claim_ctx_1 == 0) {
 				plic->claim_ctx_1 = i;
 				emu->cpu.csrs.mip |= (1 << 9);  // SEIP
+				cpu_update_interrupt_deliverable(emu);
 			}
 		}
 	}
@@ -198,6 +200,7 @@ bool plic_create(emulator_t* emu, guest_paddr base) {
 		plic,
 		plic_free,
 		plic_update,
+		NULL,
 		plic_r8,
 		plic_r16,
 		plic_r32,
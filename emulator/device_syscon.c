@@ -86,6 +86,7 @@ bool syscon_create(emulator_t* emu, guest_paddr base) {
 		syscon_base,
 		syscon_free,
 		NULL,
+		NULL,
 		syscon_r8,
 		syscon_r16,
 		syscon_r32,
@@ -205,6 +205,17 @@ static void uart8250_update(emulator_t* emu, void* device_data) {
 	}
 }
 
+static uint64_t uart8250_idle(emulator_t* emu, void* device_data, int* wake_fd) {
+	(void)emu;
+
+	uart8250_t* uart = (uart8250_t*)device_data;
+	if (uart8250_get_dr(uart)) {
+		return 0;
+	}
+	*wake_fd = uart->fd_rx;
+	return UINT64_MAX;
+}
+
 bool uart8250_create(emulator_t* emu, guest_paddr base, size_t int_number, int fd_tx, int fd_rx) {
 	uart8250_t* uart = malloc(sizeof(uart8250_t));
 	assert(uart != NULL);
@@ -219,6 +230,7 @@ bool uart8250_create(emulator_t* emu, guest_paddr base, size_t int_number, int f
 		uart,
 		uart8250_free,
 		uart8250_update,
+		uart8250_idle,
 		uart8250_r8,
 		uart8250_r16,
 		uart8250_r32,
@@ -39,6 +39,14 @@ static bool virtio_add_used_desc(emulator_t* emu, virtio_queue_t* queue, size_t
 	return true;
 }
 
+static void virtio_notify_used(emulator_t* emu, virtio_t* virtio, uint16_t avail_flags) {
+	if (!(avail_flags & VIRTQ_AVAIL_F_NO_INTERRUPT) && virtio->interrupt_status == 0 &&
+	    virtio->int_number != 0 && emu->plic != NULL) {
+		virtio->interrupt_status = (1 << 0);  // Used buffer notification
+		plic_throw_interrupt(emu, virtio->int_number);
+	}
+}
+
 static bool virtio_read_desc(emulator_t* emu, virtio_queue_t* queue, size_t desc_index, virtio_desc_t* desc) {
 	desc->desc_index = desc_index;
 
@@ -106,6 +114,9 @@ static void virtio_process_queue(emulator_t* emu, virtio_t* virtio, size_t queue
 
 		if (virtio->handlers->req_handler(emu, virtio, queue_index, &desc)) {
 			queue->queue_driver_index = i + 1;
+			if (desc.deferred) {
+				continue;
+			}
 			used_desc |= true;
 			if (!virtio_add_used_desc(emu, queue, desc.desc_index, desc.written_len)) {
 				return;
@@ -115,10 +126,8 @@ static void virtio_process_queue(emulator_t* emu, virtio_t* virtio, size_t queue
 		}
 	}
 
-	if (used_desc && !(flags & VIRTQ_AVAIL_F_NO_INTERRUPT) && virtio->interrupt_status == 0 &&
-	    virtio->int_number != 0 && emu->plic != NULL) {
-		virtio->interrupt_status = (1 << 0);  // Used buffer notification
-		plic_throw_interrupt(emu, virtio->int_number);
+	if (used_desc) {
+		virtio_notify_used(emu, virtio, flags);
 	}
 }
 
@@ -152,11 +161,24 @@ bool virtio_read_and_use_desc(emulator_t* emu, virtio_t* virtio, size_t queue_in
 	}
 	queue->queue_driver_index += 1;
 
-	if (!(flags & VIRTQ_AVAIL_F_NO_INTERRUPT) && virtio->interrupt_status == 0 &&
-	    virtio->int_number != 0 && emu->plic != NULL) {
-		virtio->interrupt_status = (1 << 0);  // Used buffer notification
-		plic_throw_interrupt(emu, virtio->int_number);
+	virtio_notify_used(emu, virtio, flags);
+	return true;
+}
+
+bool virtio_use_deferred_desc(emulator_t* emu, virtio_t* virtio, size_t queue_index, size_t desc_index, size_t desc_written_len) {
+	assert(queue_index < virtio->queue_size);
+	virtio_queue_t* queue = &virtio->queues[queue_index];
+
+	uint16_t flags;
+	if (!emu_physical_r16(emu, queue->queue_driver + 0, &flags) ||
+	    !virtio_add_used_desc(emu, queue, desc_index, desc_written_len)) {
+		return false;
 	}
+
+	virtio_notify_used(emu, virtio, flags);
+
+	// NOTE : the request handler might have refused requests while this descriptor was still in flight
+	virtio_process_queue(emu, virtio, queue_index);
 	return true;
 }
 
@@ -235,6 +257,29 @@ static void virtio_w16(emulator_t* emu, void* device_data, guest_paddr addr, uin
 	cpu_throw_exception(emu, EXC_STORE_ACCESS_FAULT, virtio->base + addr);
 }
 
+static void virtio_drop_deferred_descs(emulator_t* emu, virtio_t* virtio) {
+	if (virtio->handlers->reset_handler != NULL) {
+		virtio->handlers->reset_handler(emu, virtio);
+	}
+}
+
+static void virtio_reset(emulator_t* emu, virtio_t* virtio) {
+	// NOTE : the deferred descriptors refer to the rings of the driver, they must not be used once they are reset
+	virtio_drop_deferred_descs(emu, virtio);
+
+	virtio->status = 0;
+	virtio->device_features_sel = 0;
+	virtio->driver_features = 0;
+	virtio->driver_features_sel = 0;
+	virtio->queue_sel = 0;
+	virtio->interrupt_status = 0;
+	for (size_t i = 0; i < virtio->queue_size; i++) {
+		uint32_t queue_num_max = virtio->queues[i].queue_num_max;
+		memset(&virtio->queues[i], 0, sizeof(virtio_queue_t));
+		virtio->queues[i].queue_num_max = queue_num_max;
+	}
+}
+
 static void virtio_w32(emulator_t* emu, void* device_data, guest_paddr addr, uint32_t value) {
 	virtio_t* virtio = (virtio_t*)device_data;
 	switch (addr) {
@@ -252,11 +297,15 @@ static void virtio_w32(emulator_t* emu, void* device_data, guest_paddr addr, uin
 			virtio->queue_sel = value < virtio->queue_size ? value : 0;
 			break;
 		case VIRTIO_QUEUENUM_BASE:
+			virtio_drop_deferred_descs(emu, virtio);
 			if (value <= virtio->queues[virtio->queue_sel].queue_num_max) {
 				virtio->queues[virtio->queue_sel].queue_num = value;
 			}
 			break;
 		case VIRTIO_QUEUEREADY_BASE:
+			if (value == 0) {
+				virtio_drop_deferred_descs(emu, virtio);
+			}
 			virtio->queues[virtio->queue_sel].queue_ready = value;
 			break;
 		case VIRTIO_QUEUENOTIFY_BASE:
@@ -268,29 +317,39 @@ static void virtio_w32(emulator_t* emu, void* device_data, guest_paddr addr, uin
 			virtio->interrupt_status = 0;
 			break;
 		case VIRTIO_STATUS_BASE:
-			virtio->status = value;
+			if (value == 0) {
+				virtio_reset(emu, virtio);
+			} else {
+				virtio->status = value;
+			}
 			break;
 		case VIRTIO_QUEUEDESCLOW_BASE:
+			virtio_drop_deferred_descs(emu, virtio);
 			virtio->queues[virtio->queue_sel].queue_desc = (virtio->queues[virtio->queue_sel].queue_desc & (0xffffffffll << 32)) |
 								       value;
 			break;
 		case VIRTIO_QUEUEDESCHIGH_BASE:
+			virtio_drop_deferred_descs(emu, virtio);
 			virtio->queues[virtio->queue_sel].queue_desc = (virtio->queues[virtio->queue_sel].queue_desc & 0xffffffffll) |
 								       ((uint64_t)value << 32);
 			break;
 		case VIRTIO_QUEUEDRIVERLOW_BASE:
+			virtio_drop_deferred_descs(emu, virtio);
 			virtio->queues[virtio->queue_sel].queue_driver = (virtio->queues[virtio->queue_sel].queue_driver & (0xffffffffll << 32)) |
 									 value;
 			break;
 		case VIRTIO_QUEUEDRIVERHIGH_BASE:
+			virtio_drop_deferred_descs(emu, virtio);
 			virtio->queues[virtio->queue_sel].queue_driver = (virtio->queues[virtio->queue_sel].queue_driver & 0xffffffffll) |
 									 ((uint64_t)value << 32);
 			break;
 		case VIRTIO_QUEUEDEVICELOW_BASE:
+			virtio_drop_deferred_descs(emu, virtio);
 			virtio->queues[virtio->queue_sel].queue_device = (virtio->queues[virtio->queue_sel].queue_device & (0xffffffffll << 32)) |
 									 value;
 			break;
 		case VIRTIO_QUEUEDEVICEHIGH_BASE:
+			virtio_drop_deferred_descs(emu, virtio);
 			virtio->queues[virtio->queue_sel].queue_device = (virtio->queues[virtio->queue_sel].queue_device & 0xffffffffll) |
 									 ((uint64_t)value << 32);
 			break;
@@ -323,14 +382,22 @@ static void virtio_update(emulator_t* emu, void* device_data) {
 	}
 }
 
-bool virtio_create(emulator_t* emu, guest_paddr base, size_t int_number, uint32_t device_id, size_t queue_size, uint32_t queue_num_max, const virtio_handlers_t* handlers, void* device_data) {
+static uint64_t virtio_idle(emulator_t* emu, void* device_data, int* wake_fd) {
+	virtio_t* virtio = (virtio_t*)device_data;
+	if (virtio->handlers->idle_handler != NULL) {
+		return virtio->handlers->idle_handler(emu, virtio, wake_fd);
+	}
+	return UINT64_MAX;
+}
+
+bool virtio_create(emulator_t* emu, guest_paddr base, size_t int_number, uint32_t device_id, size_t queue_size, uint32_t queue_num_max, uint64_t device_features, const virtio_handlers_t* handlers, void* device_data) {
 	virtio_t* virtio = malloc(sizeof(virtio_t));
 	assert(virtio != NULL);
 	memset(virtio, 0, sizeof(virtio_t));
 	virtio->base = base;
 	virtio->int_number = int_number;
 	virtio->device_id = device_id;
-	virtio->device_features = (1ll << 32);  // VIRTIO_F_VERSION_1
+	virtio->device_features = (1ll << 32) | device_features;  // VIRTIO_F_VERSION_1
 	virtio->handlers = handlers;
 	virtio->device_data = device_data;
 
@@ -347,6 +414,7 @@ bool virtio_create(emulator_t* emu, guest_paddr base, size_t int_number, uint32_
 		virtio,
 		virtio_free,
 		virtio_update,
+		virtio_idle,
 		virtio_r8,
 		virtio_r16,
 		virtio_r32,
@@ -81,11 +81,13 @@ typedef struct virtio_desc_t {
 	size_t desc_index;
 	size_t bufs_len;
 	size_t written_len;
+	// NOTE : set by the request handler when the descriptor will be used later by `virtio_use_deferred_desc`
+	bool deferred;
 	struct {
 		uint64_t addr;
 		uint32_t len;
 		uint16_t flags;
-	} bufs[16];
+	} bufs[32];
 } virtio_desc_t;
 
 // NOTE : forward declaration for virtio_t
@@ -107,6 +109,17 @@ typedef bool (*virtio_req_handler_t)(emulator_t*, virtio_t*, size_t, virtio_desc
  */
 typedef void (*virtio_update_handler_t)(emulator_t*, virtio_t*);
 
+/* virtio_idle_handler_t : typedef for the virtio device idle handler
+ *                         it has the same semantics as `device_idle_handler_t`
+ */
+typedef uint64_t (*virtio_idle_handler_t)(emulator_t*, virtio_t*, int* wake_fd);
+
+/* virtio_reset_handler_t : typedef for the virtio device reset handler
+ *                          it will be called when the driver resets the device or reprograms one of its queues,
+ *                          the descriptors deferred by the device must be dropped without being used
+ */
+typedef void (*virtio_reset_handler_t)(emulator_t*, virtio_t*);
+
 /* virtio_config_{r,w}x_handler_t : typedef for the virtio device config space R/W handlers
  */
 typedef uint8_t (*virtio_config_r8_handler_t)(emulator_t*, virtio_t*, guest_paddr);
@@ -120,6 +133,8 @@ typedef struct virtio_handlers_t {
 	virtio_free_handler_t free_handler;
 	virtio_req_handler_t req_handler;
 	virtio_update_handler_t update_handler;
+	virtio_idle_handler_t idle_handler;
+	virtio_reset_handler_t reset_handler;
 	virtio_config_r8_handler_t config_r8_handler;
 	virtio_config_w8_handler_t config_w8_handler;
 	virtio_config_r32_handler_t config_r32_handler;
@@ -162,6 +177,16 @@ typedef struct virtio_t {
  */
 bool virtio_read_and_use_desc(emulator_t* emu, virtio_t* virtio, size_t queue_index, virtio_desc_t* desc, size_t desc_written_len);
 
+/* virtio_use_deferred_desc : use a virtio descriptor which was deferred by the request handler and notify the driver
+ *                            returns true if the descriptor was added to the used ring
+ *     emulator_t* emu         : pointer to the emulator
+ *     virtio_t* virtio        : pointer to the virtio device
+ *     size_t queue_index      : index of the queue the descriptor was read from
+ *     size_t desc_index       : index of the deferred descriptor
+ *     size_t desc_written_len : number of bytes written to the virtio descriptor
+ */
+bool virtio_use_deferred_desc(emulator_t* emu, virtio_t* virtio, size_t queue_index, size_t desc_index, size_t desc_written_len);
+
 /* virtio_create : create and attach a virtio device to the emulator
  *                 returns true if the device was successfully created
  *     emulator_t* emu                   : pointer to the emulator
@@ -170,9 +195,10 @@ bool virtio_read_and_use_desc(emulator_t* emu, virtio_t* virtio, size_t queue_in
  *     uint32_t device_id                : device id identifying the type of virtio device
  *     size_t queue_size                 : number of virtio queues
  *     uint32_t queue_num_max            : maximum number of virtio desc in each queues
+ *     uint64_t device_features          : device specific feature bits offered to the driver
  *     const virtio_handlers_t* handlers : pointer to the device handlers
  *     void* device_data                 : pointer to the private device data
  */
-bool virtio_create(emulator_t* emu, guest_paddr base, size_t int_number, uint32_t device_id, size_t queue_size, uint32_t queue_num_max, const virtio_handlers_t* handlers, void* device_data);
+bool virtio_create(emulator_t* emu, guest_paddr base, size_t int_number, uint32_t device_id, size_t queue_size, uint32_t queue_num_max, uint64_t device_features, const virtio_handlers_t* handlers, void* device_data);
 
 #endif
@@ -0,0 +1,144 @@
+#include <assert.h>
+#include <endian.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "device_virtio.h"
+#include "device_virtio_balloon.h"
+#include "emulator.h"
+#include "isa.h"
+
+#define VIRTIO_BALLOON_DEVICE_ID 5
+
+#define VIRTIO_BALLOON_F_PAGE_REPORTING 5
+
+#define VIRTIO_BALLOON_CFG_NUM_PAGES_BASE             0
+#define VIRTIO_BALLOON_CFG_ACTUAL_BASE                4
+#define VIRTIO_BALLOON_CFG_FREE_PAGE_HINT_CMD_ID_BASE 8
+#define VIRTIO_BALLOON_CFG_POISON_VAL_BASE            12
+
+/* NOTE : the statistics and free page hinting queues aren't offered, the free page reporting queue
+ *        comes right after the deflate queue as the driver only sets up the queues it uses
+ */
+#define VIRTIO_BALLOON_INFLATEQ   0
+#define VIRTIO_BALLOON_DEFLATEQ   1
+#define VIRTIO_BALLOON_REPORTINGQ 2
+#define VIRTIO_BALLOON_N_QUEUES   3
+
+#define VIRTIO_BALLOON_QUEUE_NUM_MAX 256
+
+#define VIRTIO_BALLOON_PFN_SHIFT 12
+#define VIRTIO_BALLOON_PAGE_SIZE (1 << VIRTIO_BALLOON_PFN_SHIFT)
+
+#define VIRTIO_BALLOON_PFNS_BUF_LEN 256
+
+typedef struct virtio_balloon_t {
+	uint32_t num_pages;
+	uint32_t actual;
+} virtio_balloon_t;
+
+static void virtio_balloon_free(emulator_t* emu, virtio_t* virtio) {
+	(void)emu;
+
+	virtio_balloon_t* virtio_balloon = (virtio_balloon_t*)virtio->device_data;
+	free(virtio_balloon);
+}
+
+static bool virtio_balloon_inflate(emulator_t* emu, virtio_desc_t* desc) {
+	for (size_t i = 0; i < desc->bufs_len; i++) {
+		// NOTE : the buffers are arrays of le32 page frame numbers of the pages given to the host
+		uint32_t pfns[VIRTIO_BALLOON_PFNS_BUF_LEN];
+		size_t pfns_len = desc->bufs[i].len / sizeof(pfns[0]);
+		for (size_t j = 0; j < pfns_len; j += VIRTIO_BALLOON_PFNS_BUF_LEN) {
+			size_t chunk_len = pfns_len - j < VIRTIO_BALLOON_PFNS_BUF_LEN ? pfns_len - j : VIRTIO_BALLOON_PFNS_BUF_LEN;
+			if (!emu_physical_read(emu, desc->bufs[i].addr + j * sizeof(pfns[0]), pfns, chunk_len * sizeof(pfns[0]))) {
+				return false;
+			}
+
+			for (size_t k = 0; k < chunk_len; k++) {
+				guest_paddr page = (guest_paddr)le32toh(pfns[k]) << VIRTIO_BALLOON_PFN_SHIFT;
+				// NOTE : pages which aren't backed by RAM are ignored, there is nothing to give back
+				emu_physical_release(emu, page, VIRTIO_BALLOON_PAGE_SIZE, false);
+			}
+		}
+	}
+	return true;
+}
+
+static bool virtio_balloon_report(emulator_t* emu, virtio_desc_t* desc) {
+	for (size_t i = 0; i < desc->bufs_len; i++) {
+		/* NOTE : the buffers are the reported free ranges themselves, the driver is likely to reuse them soon
+		 *        so we let the host reclaim them lazily
+		 */
+		emu_physical_release(emu, desc->bufs[i].addr, desc->bufs[i].len, true);
+	}
+	return true;
+}
+
+static bool virtio_balloon_req(emulator_t* emu, virtio_t* virtio, size_t queue_index, virtio_desc_t* desc) {
+	(void)virtio;
+
+	desc->written_len = 0;
+	switch (queue_index) {
+		case VIRTIO_BALLOON_INFLATEQ:
+			return virtio_balloon_inflate(emu, desc);
+		case VIRTIO_BALLOON_DEFLATEQ:
+			// NOTE : the released pages are allocated again by the host on their next access
+			return true;
+		case VIRTIO_BALLOON_REPORTINGQ:
+			return virtio_balloon_report(emu, desc);
+		default:
+			return false;
+	}
+}
+
+static uint32_t virtio_balloon_r32_config(emulator_t* emu, virtio_t* virtio, guest_paddr addr) {
+	virtio_balloon_t* virtio_balloon = (virtio_balloon_t*)virtio->device_data;
+	switch (addr) {
+		case VIRTIO_BALLOON_CFG_NUM_PAGES_BASE:
+			return virtio_balloon->num_pages;
+		case VIRTIO_BALLOON_CFG_ACTUAL_BASE:
+			return virtio_balloon->actual;
+		case VIRTIO_BALLOON_CFG_FREE_PAGE_HINT_CMD_ID_BASE:
+		case VIRTIO_BALLOON_CFG_POISON_VAL_BASE:
+			return 0;
+		default:
+			cpu_throw_exception(emu, EXC_LOAD_ACCESS_FAULT, virtio->base + VIRTIO_CONFIG_BASE + addr);
+			return 0;
+	}
+}
+
+static void virtio_balloon_w32_config(emulator_t* emu, virtio_t* virtio, guest_paddr addr, uint32_t value) {
+	virtio_balloon_t* virtio_balloon = (virtio_balloon_t*)virtio->device_data;
+	switch (addr) {
+		case VIRTIO_BALLOON_CFG_ACTUAL_BASE:
+			virtio_balloon->actual = value;
+			break;
+		case VIRTIO_BALLOON_CFG_POISON_VAL_BASE:
+			break;
+		default:
+			cpu_throw_exception(emu, EXC_STORE_ACCESS_FAULT, virtio->base + VIRTIO_CONFIG_BASE + addr);
+			break;
+	}
+}
+
+static const virtio_handlers_t virtio_balloon_handlers = {
+	.free_handler = virtio_balloon_free,
+	.req_handler = virtio_balloon_req,
+	.config_r32_handler = virtio_balloon_r32_config,
+	.config_w32_handler = virtio_balloon_w32_config,
+};
+
+bool virtio_balloon_create(emulator_t* emu, guest_paddr base, size_t int_number, uint32_t num_pages) {
+	virtio_balloon_t* virtio_balloon = malloc(sizeof(virtio_balloon_t));
+	assert(virtio_balloon != NULL);
+
+	virtio_balloon->num_pages = num_pages;
+	virtio_balloon->actual = 0;
+
+	return virtio_create(emu, base, int_number, VIRTIO_BALLOON_DEVICE_ID, VIRTIO_BALLOON_N_QUEUES,
+			     VIRTIO_BALLOON_QUEUE_NUM_MAX, 1ull << VIRTIO_BALLOON_F_PAGE_REPORTING,
+			     &virtio_balloon_handlers, virtio_balloon);
+}
@@ -0,0 +1,20 @@
+#ifndef DEVICE_VIRTIO_BALLOON_H
+#define DEVICE_VIRTIO_BALLOON_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "emulator.h"
+#include "isa.h"
+
+/* virtio_balloon_create : create and attach a virtio balloon device to the emulator
+ *                         returns true if the balloon device was successfully created
+ *     emulator_t* emu    : pointer to the emulator
+ *     guest_paddr base   : base address of the balloon device
+ *     size_t int_number  : interrupt source number if the balloon device is connected to the PLIC
+ *     uint32_t num_pages : number of 4 KiB pages the driver is asked to give back to the host
+ */
+bool virtio_balloon_create(emulator_t* emu, guest_paddr base, size_t int_number, uint32_t num_pages);
+
+#endif
@@ -1,11 +1,27 @@
+#define _GNU_SOURCE
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef RISCV_EMULATOR_IO_URING_SUPPORT
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
 
 #include "device_virtio.h"
 #include "device_virtio_block.h"
 #include "emulator.h"
 #include "isa.h"
+#include "mmu_paging_guest_to_host.h"
 
 #define VIRTIO_BLK_DEVICE_ID 2
 
@@ -29,19 +45,465 @@
 
 #define VIRTIO_BLK_SECTOR_SIZE 512
 
+#ifdef RISCV_EMULATOR_IO_URING_SUPPORT
+/* VIRTIO_BLOCK_MAX_SEGMENTS : maximum number of host spans of guest RAM transferred by a single request, the
+ *                             data of a request split in more spans goes through a bounce buffer
+ */
+#define VIRTIO_BLOCK_MAX_SEGMENTS 16
+
+/* virtio_block_uring_t : structure storing the rings shared with the host kernel, the pointers refer to the
+ *                        fields described by `struct io_uring_params`
+ */
+typedef struct virtio_block_uring_t {
+	int fd;
+
+	void* sq_ring;
+	size_t sq_ring_size;
+	uint32_t* sq_tail;
+	uint32_t* sq_mask;
+	uint32_t* sq_array;
+	struct io_uring_sqe* sqes;
+	size_t sqes_size;
+
+	void* cq_ring;
+	size_t cq_ring_size;
+	uint32_t* cq_head;
+	uint32_t* cq_tail;
+	uint32_t* cq_mask;
+	struct io_uring_cqe* cqes;
+} virtio_block_uring_t;
+
+/* virtio_block_request_t : structure storing a request submitted to the io_uring, indexed by the index of its
+ *                          virtio descriptor which is used once the request completes
+ */
+typedef struct virtio_block_request_t {
+	bool in_flight;
+	bool to_guest;
+	bool ret;  // false if the request already failed, the sectors past the end of the image aren't transferred
+	guest_paddr data_addr;
+	guest_paddr status_addr;
+	uint64_t offset;
+	size_t transfer_len;
+	size_t done_len;
+	uint8_t* bounce;  // NULL if the segments point directly to the guest RAM
+
+	size_t segments_len;
+	struct iovec segments[VIRTIO_BLOCK_MAX_SEGMENTS];
+	guest_paddr segments_paddr[VIRTIO_BLOCK_MAX_SEGMENTS];
+	// NOTE : the segments remaining after a short transfer, they have to live until the completion
+	struct iovec submitted_segments[VIRTIO_BLOCK_MAX_SEGMENTS];
+} virtio_block_request_t;
+#endif
+
 typedef struct virtio_block_t {
 	size_t capacity;
-	FILE* image;
+	int image_fd;
+	virtio_block_backend_t backend;
+	uint8_t* image_mapping;  // NULL unless the backend is VIRTIO_BLOCK_BACKEND_MMAP
+
+	// NOTE : end of the previous read and of the window already hinted to the host kernel
+	uint64_t next_read_offset;
+	uint64_t readahead_end;
+
+#ifdef RISCV_EMULATOR_IO_URING_SUPPORT
+	virtio_block_uring_t uring;
+	bool direct;  // the image is opened with O_DIRECT, the segments have to be aligned on sectors
+	virtio_block_request_t* requests;
+	size_t requests_in_flight;
+#endif
 } virtio_block_t;
 
-static void virtio_block_free(emulator_t* emu, virtio_t* virtio) {
+#ifdef RISCV_EMULATOR_IO_URING_SUPPORT
+static bool virtio_block_uring_setup(virtio_block_uring_t* uring, unsigned int entries) {
+	struct io_uring_params params;
+	memset(&params, 0, sizeof(params));
+	uring->sq_ring = uring->cq_ring = uring->sqes = MAP_FAILED;
+	uring->fd = syscall(__NR_io_uring_setup, entries, &params);
+	if (uring->fd < 0) {
+		perror("io_uring_setup");
+		return false;
+	}
+
+	uring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+	uring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+	if (params.features & IORING_FEAT_SINGLE_MMAP) {
+		if (uring->cq_ring_size > uring->sq_ring_size) {
+			uring->sq_ring_size = uring->cq_ring_size;
+		}
+		uring->cq_ring_size = uring->sq_ring_size;
+	}
+	uring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+
+	uring->sq_ring = mmap(NULL, uring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+			      uring->fd, IORING_OFF_SQ_RING);
+	if (uring->sq_ring != MAP_FAILED) {
+		uring->cq_ring = (params.features & IORING_FEAT_SINGLE_MMAP)
+					 ? uring->sq_ring
+					 : mmap(NULL, uring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+						uring->fd, IORING_OFF_CQ_RING);
+		uring->sqes = mmap(NULL, uring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+				   uring->fd, IORING_OFF_SQES);
+	}
+	if (uring->sq_ring == MAP_FAILED || uring->cq_ring == MAP_FAILED || uring->sqes == MAP_FAILED) {
+		perror("mmap");
+		return false;
+	}
+
+	uint8_t* sq_ring = uring->sq_ring;
+	uring->sq_tail = (uint32_t*)(sq_ring + params.sq_off.tail);
+	uring->sq_mask = (uint32_t*)(sq_ring + params.sq_off.ring_mask);
+	uring->sq_array = (uint32_t*)(sq_ring + params.sq_off.array);
+
+	uint8_t* cq_ring = uring->cq_ring;
+	uring->cq_head = (uint32_t*)(cq_ring + params.cq_off.head);
+	uring->cq_tail = (uint32_t*)(cq_ring + params.cq_off.tail);
+	uring->cq_mask = (uint32_t*)(cq_ring + params.cq_off.ring_mask);
+	uring->cqes = (struct io_uring_cqe*)(cq_ring + params.cq_off.cqes);
+	return true;
+}
+
+static void virtio_block_uring_free(virtio_block_uring_t* uring) {
+	if (uring->sqes != MAP_FAILED) {
+		munmap(uring->sqes, uring->sqes_size);
+	}
+	if (uring->cq_ring != MAP_FAILED && uring->cq_ring != uring->sq_ring) {
+		munmap(uring->cq_ring, uring->cq_ring_size);
+	}
+	if (uring->sq_ring != MAP_FAILED) {
+		munmap(uring->sq_ring, uring->sq_ring_size);
+	}
+	if (uring->fd >= 0) {
+		close(uring->fd);
+	}
+}
+
+static void virtio_block_uring_submit(virtio_block_t* virtio_block, size_t desc_index) {
+	virtio_block_request_t* request = &virtio_block->requests[desc_index];
+	virtio_block_uring_t* uring = &virtio_block->uring;
+
+	size_t skipped_len = request->done_len;
+	size_t submitted_len = 0;
+	for (size_t i = 0; i < request->segments_len; i++) {
+		if (skipped_len >= request->segments[i].iov_len) {
+			skipped_len -= request->segments[i].iov_len;
+			continue;
+		}
+		request->submitted_segments[submitted_len].iov_base = (uint8_t*)request->segments[i].iov_base + skipped_len;
+		request->submitted_segments[submitted_len].iov_len = request->segments[i].iov_len - skipped_len;
+		skipped_len = 0;
+		submitted_len++;
+	}
+
+	// NOTE : the emulator is the only producer of the submission queue, the kernel only reads the tail
+	uint32_t tail = *uring->sq_tail;
+	uint32_t index = tail & *uring->sq_mask;
+	struct io_uring_sqe* sqe = &uring->sqes[index];
+	memset(sqe, 0, sizeof(*sqe));
+	sqe->opcode = request->to_guest ? IORING_OP_READV : IORING_OP_WRITEV;
+	sqe->fd = virtio_block->image_fd;
+	sqe->addr = (uintptr_t)request->submitted_segments;
+	sqe->len = submitted_len;
+	sqe->off = request->offset + request->done_len;
+	sqe->user_data = desc_index;
+	uring->sq_array[index] = index;
+	__atomic_store_n(uring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+	int ret;
+	do {
+		ret = syscall(__NR_io_uring_enter, uring->fd, 1, 0, 0, NULL, 0);
+	} while (ret < 0 && errno == EINTR);
+	if (ret != 1) {
+		perror("io_uring_enter");
+		abort();
+	}
+}
+
+static void virtio_block_uring_complete(emulator_t* emu, virtio_t* virtio, size_t desc_index, int32_t res, bool draining) {
+	virtio_block_t* virtio_block = (virtio_block_t*)virtio->device_data;
+	virtio_block_request_t* request = &virtio_block->requests[desc_index];
+	assert(request->in_flight);
+
+	if (res == -EINVAL && virtio_block->direct) {
+		// NOTE : the logical blocks of the host device are larger than a sector, we fall back to buffered I/O
+		fprintf(stderr, "Unable to use direct I/O on the block device image, falling back to buffered I/O\n");
+		int flags = fcntl(virtio_block->image_fd, F_GETFL);
+		if (flags < 0 || fcntl(virtio_block->image_fd, F_SETFL, flags & ~O_DIRECT) != 0) {
+			perror("fcntl");
+			abort();
+		}
+		virtio_block->direct = false;
+		virtio_block_uring_submit(virtio_block, desc_index);
+		return;
+	}
+
+	if (res > 0) {
+		request->done_len += res;
+		if (request->done_len < request->transfer_len) {
+			virtio_block_uring_submit(virtio_block, desc_index);
+			return;
+		}
+	}
+
+	request->in_flight = false;
+	virtio_block->requests_in_flight--;
+
+	bool ret = request->ret && res >= 0 && request->done_len == request->transfer_len;
+	if (request->bounce != NULL) {
+		if (!draining && request->to_guest) {
+			ret &= emu_physical_write(emu, request->data_addr, request->bounce, request->done_len);
+		}
+	} else {
+		// NOTE : the RAM regions outlive the devices, the pages are also prepared and unpinned when draining
+		for (size_t i = 0; i < request->segments_len; i++) {
+			if (request->to_guest) {
+				// NOTE : the pages might have been logged as clean again while the host kernel was filling them
+				mmu_pg2h_prepare_write(emu, request->segments_paddr[i], request->segments[i].iov_len);
+			}
+			mmu_pg2h_dedup_pin(emu, request->segments_paddr[i], request->segments[i].iov_len, false);
+		}
+	}
+	free(request->bounce);
+	request->bounce = NULL;
+
+	if (!draining) {
+		size_t written_len = request->to_guest ? request->done_len + 1 : 1;
+		emu_physical_w8(emu, request->status_addr, ret ? VIRTIO_BLK_S_OK : VIRTIO_BLK_S_IOERR);
+		virtio_use_deferred_desc(emu, virtio, VIRTIO_BLK_REQUESTQ, desc_index, written_len);
+	}
+}
+
+static bool virtio_block_uring_has_completions(virtio_block_uring_t* uring) {
+	return *uring->cq_head != __atomic_load_n(uring->cq_tail, __ATOMIC_ACQUIRE);
+}
+
+static void virtio_block_uring_reap(emulator_t* emu, virtio_t* virtio, bool draining) {
+	virtio_block_t* virtio_block = (virtio_block_t*)virtio->device_data;
+	virtio_block_uring_t* uring = &virtio_block->uring;
+
+	while (virtio_block_uring_has_completions(uring)) {
+		uint32_t head = *uring->cq_head;
+		struct io_uring_cqe* cqe = &uring->cqes[head & *uring->cq_mask];
+		size_t desc_index = cqe->user_data;
+		int32_t res = cqe->res;
+		__atomic_store_n(uring->cq_head, head + 1, __ATOMIC_RELEASE);
+
+		virtio_block_uring_complete(emu, virtio, desc_index, res, draining);
+	}
+}
+
+static bool virtio_block_uring_req(emulator_t* emu, virtio_block_t* virtio_block, virtio_desc_t* desc, bool to_guest, uint64_t offset, size_t transfer_len, bool ret) {
+	if (desc->desc_index >= VIRTIO_BLK_QUEUE_NUM_MAX || virtio_block->requests[desc->desc_index].in_flight) {
+		return false;
+	}
+	virtio_block_request_t* request = &virtio_block->requests[desc->desc_index];
+	request->to_guest = to_guest;
+	request->ret = ret;
+	request->data_addr = desc->bufs[1].addr;
+	request->status_addr = desc->bufs[2].addr;
+	request->offset = offset;
+	request->transfer_len = transfer_len;
+	request->done_len = 0;
+	request->bounce = NULL;
+	request->segments_len = 0;
+
+	guest_paddr paddr = request->data_addr;
+	size_t len = transfer_len;
+	while (len > 0) {
+		size_t span_len = len;
+		uint8_t* host_addr = emu_physical_host_span(emu, paddr, &span_len);
+		if (host_addr == NULL || request->segments_len == VIRTIO_BLOCK_MAX_SEGMENTS ||
+		    (virtio_block->direct && (((uintptr_t)host_addr | span_len) & (VIRTIO_BLK_SECTOR_SIZE - 1)) != 0)) {
+			request->segments_len = 0;
+			break;
+		}
+		request->segments[request->segments_len].iov_base = host_addr;
+		request->segments[request->segments_len].iov_len = span_len;
+		request->segments_paddr[request->segments_len] = paddr;
+		request->segments_len++;
+		paddr += span_len;
+		len -= span_len;
+	}
+
+	if (request->segments_len == 0) {
+		// NOTE : MMIO, fragmented or misaligned buffers go through a bounce buffer aligned for direct I/O
+		void* bounce;
+		if (posix_memalign(&bounce, MMU_PG2H_PAGE_SIZE, transfer_len) != 0) {
+			return false;
+		}
+		request->bounce = bounce;
+		if (!to_guest && !emu_physical_read(emu, request->data_addr, request->bounce, transfer_len)) {
+			free(request->bounce);
+			request->bounce = NULL;
+			return false;
+		}
+		request->segments[0].iov_base = request->bounce;
+		request->segments[0].iov_len = transfer_len;
+		request->segments_len = 1;
+	} else {
+		// NOTE : the host kernel accesses the guest RAM directly, the deduplication must not remap it meanwhile
+		for (size_t i = 0; i < request->segments_len; i++) {
+			if (to_guest) {
+				mmu_pg2h_prepare_write(emu, request->segments_paddr[i], request->segments[i].iov_len);
+			}
+			mmu_pg2h_dedup_pin(emu, request->segments_paddr[i], request->segments[i].iov_len, true);
+		}
+	}
+
+	request->in_flight = true;
+	virtio_block->requests_in_flight++;
+	virtio_block_uring_submit(virtio_block, desc->desc_index);
+
+	desc->deferred = true;
+	return true;
+}
+
+static void virtio_block_uring_drain(emulator_t* emu, virtio_t* virtio) {
+	virtio_block_t* virtio_block = (virtio_block_t*)virtio->device_data;
+	while (virtio_block->requests_in_flight > 0) {
+		if (syscall(__NR_io_uring_enter, virtio_block->uring.fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0) < 0 &&
+		    errno != EINTR) {
+			perror("io_uring_enter");
+			abort();
+		}
+		virtio_block_uring_reap(emu, virtio, true);
+	}
+}
+
+static void virtio_block_reset(emulator_t* emu, virtio_t* virtio) {
+	/* NOTE : reads and writes of a regular file can't be cancelled once the host kernel started them, the
+	 *        requests in flight are waited for and their completions aren't reported to the reset rings
+	 */
+	virtio_block_uring_drain(emu, virtio);
+}
+
+static void virtio_block_update(emulator_t* emu, virtio_t* virtio) {
+	virtio_block_t* virtio_block = (virtio_block_t*)virtio->device_data;
+	if (virtio_block->requests_in_flight > 0) {
+		virtio_block_uring_reap(emu, virtio, false);
+	}
+}
+
+static uint64_t virtio_block_idle(emulator_t* emu, virtio_t* virtio, int* wake_fd) {
 	(void)emu;
 
 	virtio_block_t* virtio_block = (virtio_block_t*)virtio->device_data;
-	fclose(virtio_block->image);
+	if (virtio_block->requests_in_flight == 0) {
+		return UINT64_MAX;
+	} else if (virtio_block_uring_has_completions(&virtio_block->uring)) {
+		return 0;
+	}
+	// NOTE : the io_uring file descriptor becomes readable when a completion is posted
+	*wake_fd = virtio_block->uring.fd;
+	return UINT64_MAX;
+}
+#endif
+
+static void virtio_block_free(emulator_t* emu, virtio_t* virtio) {
+	virtio_block_t* virtio_block = (virtio_block_t*)virtio->device_data;
+#ifdef RISCV_EMULATOR_IO_URING_SUPPORT
+	if (virtio_block->requests != NULL) {
+		// NOTE : the other devices might already be freed, the requests still in flight are only waited for
+		virtio_block_uring_drain(emu, virtio);
+		free(virtio_block->requests);
+		virtio_block_uring_free(&virtio_block->uring);
+	}
+#else
+	(void)emu;
+#endif
+
+	if (virtio_block->image_mapping != NULL) {
+		size_t image_size = virtio_block->capacity * VIRTIO_BLK_SECTOR_SIZE;
+		msync(virtio_block->image_mapping, image_size, MS_SYNC);
+		munmap(virtio_block->image_mapping, image_size);
+	}
+	close(virtio_block->image_fd);
 	free(virtio_block);
 }
 
+static void virtio_block_readahead(virtio_block_t* virtio_block, uint64_t offset, size_t len) {
+	bool sequential = offset == virtio_block->next_read_offset;
+	uint64_t end = offset + len;
+	virtio_block->next_read_offset = end;
+
+	// NOTE : the window is extended once the stream consumed half of it, random reads don't hint anything
+	if (!sequential || end + VIRTIO_BLOCK_READAHEAD_SIZE / 2 <= virtio_block->readahead_end) {
+		return;
+	}
+
+	uint64_t image_size = virtio_block->capacity * VIRTIO_BLK_SECTOR_SIZE;
+	uint64_t start = (end > virtio_block->readahead_end ? end : virtio_block->readahead_end) & MMU_PG2H_PAGE_MASK;
+	uint64_t stop = end + VIRTIO_BLOCK_READAHEAD_SIZE;
+	if (stop > image_size) {
+		stop = image_size;
+	}
+	if (start >= stop) {
+		return;
+	}
+
+	// NOTE : the hints are only advisory, a failure doesn't affect the requests
+	if (virtio_block->backend == VIRTIO_BLOCK_BACKEND_MMAP) {
+		madvise(virtio_block->image_mapping + start, stop - start, MADV_WILLNEED);
+	} else {
+		posix_fadvise(virtio_block->image_fd, start, stop - start, POSIX_FADV_WILLNEED);
+	}
+	virtio_block->readahead_end = stop;
+}
+
+static bool virtio_block_copy(virtio_block_t* virtio_block, uint8_t* host_addr, size_t len, uint64_t offset, bool to_guest) {
+	if (virtio_block->backend == VIRTIO_BLOCK_BACKEND_MMAP) {
+		if (to_guest) {
+			memcpy(host_addr, virtio_block->image_mapping + offset, len);
+		} else {
+			memcpy(virtio_block->image_mapping + offset, host_addr, len);
+		}
+		return true;
+	}
+
+	while (len > 0) {
+		ssize_t ret = to_guest ? pread(virtio_block->image_fd, host_addr, len, offset)
+				       : pwrite(virtio_block->image_fd, host_addr, len, offset);
+		if (ret < 0 && errno == EINTR) {
+			continue;
+		} else if (ret <= 0) {
+			return false;
+		}
+		host_addr += ret;
+		offset += ret;
+		len -= ret;
+	}
+	return true;
+}
+
+static bool virtio_block_transfer(emulator_t* emu, virtio_block_t* virtio_block, guest_paddr paddr, size_t len, uint64_t offset, bool to_guest) {
+	while (len > 0) {
+		size_t span_len = len;
+		uint8_t* host_addr = emu_physical_host_span(emu, paddr, &span_len);
+		uint8_t mmio_byte;
+		if (host_addr == NULL) {
+			// NOTE : the buffers which aren't backed by RAM are transferred byte per byte through their device
+			host_addr = &mmio_byte;
+			span_len = 1;
+			if (!to_guest && !emu_physical_r8(emu, paddr, &mmio_byte)) {
+				return false;
+			}
+		} else if (to_guest) {
+			mmu_pg2h_prepare_write(emu, paddr, span_len);
+		}
+
+		if (!virtio_block_copy(virtio_block, host_addr, span_len, offset, to_guest)) {
+			return false;
+		}
+		if (host_addr == &mmio_byte && to_guest && !emu_physical_w8(emu, paddr, mmio_byte)) {
+			return false;
+		}
+
+		paddr += span_len;
+		offset += span_len;
+		len -= span_len;
+	}
+	return true;
+}
+
 static bool virtio_block_req(emulator_t* emu, virtio_t* virtio, size_t queue_index, virtio_desc_t* desc) {
 	assert(queue_index == VIRTIO_BLK_REQUESTQ);
 	virtio_block_t* virtio_block = (virtio_block_t*)virtio->device_data;
@@ -69,29 +531,37 @@ static bool virtio_block_req(emulator_t* emu, virtio_t* virtio, size_t queue_ind
 		return false;
 	}
 
-	bool ret = true;
+	// NOTE : the sectors past the end of the image are not transferred and the request fails
 	size_t data_len = desc->bufs[1].len;
+	uint64_t offset = sector * VIRTIO_BLK_SECTOR_SIZE;
+	size_t transfer_len = 0;
+	if (sector < virtio_block->capacity) {
+		uint64_t available_sectors = virtio_block->capacity - sector;
+		transfer_len = data_len / VIRTIO_BLK_SECTOR_SIZE <= available_sectors ? data_len
+										  : available_sectors * VIRTIO_BLK_SECTOR_SIZE;
+	}
+
+	bool ret = transfer_len == data_len;
+#ifdef RISCV_EMULATOR_IO_URING_SUPPORT
+	if (virtio_block->requests != NULL && transfer_len > 0 &&
+	    (type == VIRTIO_BLK_T_OUT || (type == VIRTIO_BLK_T_IN && (desc->bufs[1].flags & VIRTQ_DESC_F_WRITE)))) {
+		if (type == VIRTIO_BLK_T_IN && !virtio_block->direct) {
+			virtio_block_readahead(virtio_block, offset, transfer_len);
+		}
+		return virtio_block_uring_req(emu, virtio_block, desc, type == VIRTIO_BLK_T_IN, offset, transfer_len, ret);
+	}
+#endif
+
 	if (type == VIRTIO_BLK_T_IN && (desc->bufs[1].flags & VIRTQ_DESC_F_WRITE)) {
-		ret &= fseek(virtio_block->image, sector * VIRTIO_BLK_SECTOR_SIZE, SEEK_SET) == 0;
-		uint8_t* data_buf = malloc(data_len);
-		assert(data_buf != NULL);
-		size_t read_buf = fread(data_buf, 1, data_len, virtio_block->image);
-		ret &= read_buf == data_len;
-		for (size_t i = 0; i < read_buf; i++) {
-			ret &= emu_physical_w8(emu, desc->bufs[1].addr + i, data_buf[i]);
+		virtio_block_readahead(virtio_block, offset, transfer_len);
+		if (!virtio_block_transfer(emu, virtio_block, desc->bufs[1].addr, transfer_len, offset, true)) {
+			ret = false;
+			transfer_len = 0;
 		}
-		free(data_buf);
 
-		desc->written_len = read_buf + 1;
+		desc->written_len = transfer_len + 1;
 	} else if (type == VIRTIO_BLK_T_OUT) {
-		ret &= fseek(virtio_block->image, sector * VIRTIO_BLK_SECTOR_SIZE, SEEK_SET) == 0;
-		uint8_t* data_buf = malloc(data_len);
-		assert(data_buf != NULL);
-		for (size_t i = 0; i < data_len; i++) {
-			ret &= emu_physical_r8(emu, desc->bufs[1].addr + i, &data_buf[i]);
-		}
-		ret &= fwrite(data_buf, 1, data_len, virtio_block->image) == data_len;
-		free(data_buf);
+		ret &= virtio_block_transfer(emu, virtio_block, desc->bufs[1].addr, transfer_len, offset, false);
 
 		desc->written_len = 1;
 	} else {
@@ -122,23 +592,66 @@ static void virtio_block_w32_config(emulator_t* emu, virtio_t* virtio, guest_pad
 static const virtio_handlers_t virtio_block_handlers = {
 	.free_handler = virtio_block_free,
 	.req_handler = virtio_block_req,
+#ifdef RISCV_EMULATOR_IO_URING_SUPPORT
+	.update_handler = virtio_block_update,
+	.idle_handler = virtio_block_idle,
+	.reset_handler = virtio_block_reset,
+#endif
 	.config_r32_handler = virtio_block_r32_config,
 	.config_w32_handler = virtio_block_w32_config,
 };
 
-bool virtio_block_create(emulator_t* emu, guest_paddr base, size_t int_number, FILE* image) {
-	if (fseek(image, 0, SEEK_END) != 0) {
-		fclose(image);
+bool virtio_block_create(emulator_t* emu, guest_paddr base, size_t int_number, int image_fd, virtio_block_backend_t backend) {
+	struct stat image_stat;
+	if (fstat(image_fd, &image_stat) != 0) {
+		perror("fstat");
+		close(image_fd);
 		return false;
 	}
-	size_t capacity = ftell(image) / VIRTIO_BLK_SECTOR_SIZE;
+	size_t capacity = image_stat.st_size / VIRTIO_BLK_SECTOR_SIZE;
+
+	uint8_t* image_mapping = NULL;
+	if (backend == VIRTIO_BLOCK_BACKEND_MMAP) {
+		if (capacity == 0) {
+			fprintf(stderr, "Unable to map an empty block device image\n");
+			close(image_fd);
+			return false;
+		}
+		image_mapping = mmap(NULL, capacity * VIRTIO_BLK_SECTOR_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, image_fd, 0);
+		if (image_mapping == MAP_FAILED) {
+			perror("mmap");
+			close(image_fd);
+			return false;
+		}
+	}
 
 	virtio_block_t* virtio_block = malloc(sizeof(virtio_block_t));
 	assert(virtio_block != NULL);
 
-	virtio_block->image = image;
+	virtio_block->image_fd = image_fd;
 	virtio_block->capacity = capacity;
+	virtio_block->backend = backend;
+	virtio_block->image_mapping = image_mapping;
+	virtio_block->next_read_offset = (uint64_t)-1;
+	virtio_block->readahead_end = 0;
+
+#ifdef RISCV_EMULATOR_IO_URING_SUPPORT
+	virtio_block->requests = NULL;
+	virtio_block->requests_in_flight = 0;
+	virtio_block->direct = backend == VIRTIO_BLOCK_BACKEND_IO_URING_DIRECT;
+	if (backend == VIRTIO_BLOCK_BACKEND_IO_URING || backend == VIRTIO_BLOCK_BACKEND_IO_URING_DIRECT) {
+		if (!virtio_block_uring_setup(&virtio_block->uring, VIRTIO_BLK_QUEUE_NUM_MAX)) {
+			virtio_block_uring_free(&virtio_block->uring);
+			close(image_fd);
+			free(virtio_block);
+			return false;
+		}
+		virtio_block->requests = malloc(VIRTIO_BLK_QUEUE_NUM_MAX * sizeof(virtio_block_request_t));
+		assert(virtio_block->requests != NULL);
+		memset(virtio_block->requests, 0, VIRTIO_BLK_QUEUE_NUM_MAX * sizeof(virtio_block_request_t));
+	}
+#endif
 
 	return virtio_create(emu, base, int_number, VIRTIO_BLK_DEVICE_ID, VIRTIO_BLK_N_QUEUES,
-			     VIRTIO_BLK_QUEUE_NUM_MAX, &virtio_block_handlers, virtio_block);
+			     VIRTIO_BLK_QUEUE_NUM_MAX, 0, &virtio_block_handlers, virtio_block);
 }
@@ -2,18 +2,24 @@
 #define DEVICE_VIRTIO_BLOCK_H
 
 #include <stdbool.h>
-#include <stdio.h>
+#include <stddef.h>
 
 #include "emulator.h"
 #include "isa.h"
 
+/* VIRTIO_BLOCK_READAHEAD_SIZE : size of the window of the image hinted to the host kernel ahead of a
+ *                               sequential stream of reads
+ */
+#define VIRTIO_BLOCK_READAHEAD_SIZE (2 << 20)
+
 /* virtio_block_create : create and attach a virtio block device to the emulator
  *                       returns true if the block device was successfully created
- *     emulator_t* emu   : pointer to the emulator
- *     guest_paddr base  : base address of the block device
- *     size_t int_number : interrupt source number if the block device is connected to the PLIC
- *     FILE* image       : pointer to an open file storing the raw block device image
+ *     emulator_t* emu                : pointer to the emulator
+ *     guest_paddr base               : base address of the block device
+ *     size_t int_number              : interrupt source number if the block device is connected to the PLIC
+ *     int image_fd                   : open file descriptor of the raw block device image, owned by the device
+ *     virtio_block_backend_t backend : way the device accesses the image
  */
-bool virtio_block_create(emulator_t* emu, guest_paddr base, size_t int_number, FILE* image);
+bool virtio_block_create(emulator_t* emu, guest_paddr base, size_t int_number, int image_fd, virtio_block_backend_t backend);
 
 #endif
@@ -400,7 +400,7 @@ bool virtio_input_create(emulator_t* emu, guest_paddr base, size_t int_number) {
 	memset(virtio_input, 0, sizeof(virtio_input_t));
 
 	return virtio_create(emu, base, int_number, VIRTIO_INPUT_DEVICE_ID, VIRTIO_INPUT_N_QUEUES,
-			     VIRTIO_INPUT_QUEUE_NUM_MAX, &virtio_input_handlers, virtio_input);
+			     VIRTIO_INPUT_QUEUE_NUM_MAX, 0, &virtio_input_handlers, virtio_input);
 }
 
 #endif
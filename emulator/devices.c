@@ -1,4 +1,7 @@
+#define _GNU_SOURCE
+#include <fcntl.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <unistd.h>
 
 #include "device_clint.h"
@@ -6,6 +9,7 @@
 #include "device_plic.h"
 #include "device_syscon.h"
 #include "device_uart8250.h"
+#include "device_virtio_balloon.h"
 #include "device_virtio_block.h"
 #include "device_virtio_input.h"
 #include "devices.h"
@@ -14,10 +18,16 @@
 
 // The created machine is following the device tree described in `linux/emulator.dts`
 
-bool devices_create_virt_machine(emulator_t* emu, const char* hdd_file) {
-	FILE* hdd_image = fopen(hdd_file, "r+b");
-	if (hdd_image == NULL) {
-		perror("fopen");
+bool devices_create_virt_machine(emulator_t* emu, const char* hdd_file, virtio_block_backend_t hdd_backend, uint32_t balloon_pages) {
+	int hdd_flags = O_RDWR | O_CLOEXEC;
+#ifdef RISCV_EMULATOR_IO_URING_SUPPORT
+	if (hdd_backend == VIRTIO_BLOCK_BACKEND_IO_URING_DIRECT) {
+		hdd_flags |= O_DIRECT;
+	}
+#endif
+	int hdd_image_fd = open(hdd_file, hdd_flags);
+	if (hdd_image_fd < 0) {
+		perror("open");
 		return false;
 	}
 
@@ -32,11 +42,12 @@ bool devices_create_virt_machine(emulator_t* emu, const char* hdd_file) {
 	CREATE_CHECKED(uart8250, 0x10000000, 1, STDOUT_FILENO, STDIN_FILENO);
 	CREATE_CHECKED(clint, 0x20000000);
 	CREATE_CHECKED(plic, 0x30000000);
-	CREATE_CHECKED(virtio_block, 0x40000000, 2, hdd_image);
+	CREATE_CHECKED(virtio_block, 0x40000000, 2, hdd_image_fd, hdd_backend);
 #ifdef RISCV_EMULATOR_SDL_SUPPORT
 	CREATE_CHECKED(virtio_input, 0x40001000, 3);
 	CREATE_CHECKED(framebuffer, 0x50000000, 800, 600);
 #endif
+	CREATE_CHECKED(virtio_balloon, 0x40002000, 4, balloon_pages);
 	CREATE_CHECKED(syscon, 0x60000000);
 
 #undef CREATE_CHECKED
@@ -21,6 +21,14 @@ typedef void (*device_free_handler_t)(emulator_t*, void*);
  */
 typedef void (*device_update_handler_t)(emulator_t*, void*);
 
+/* device_idle_handler_t : typedef for the MMIO device idle handler
+ *                         it will be called by the emulator before waiting for an event while the
+ *                         CPU is idle, it should return the maximum time in nanoseconds to wait
+ *                         before the next update of the device and it can set `wake_fd` to a file
+ *                         descriptor which wakes up the emulator when it becomes readable
+ */
+typedef uint64_t (*device_idle_handler_t)(emulator_t*, void*, int* wake_fd);
+
 /* device_{r,w}x_handler_t : typedef for the MMIO device R/W handlers
  */
 typedef uint8_t (*device_r8_handler_t)(emulator_t*, void*, guest_paddr);
@@ -39,6 +47,7 @@ typedef struct device_mmio_t {
 
 	device_free_handler_t free_handler;
 	device_update_handler_t update_handler;
+	device_idle_handler_t idle_handler;
 
 	device_r8_handler_t r8_handler;
 	device_r16_handler_t r16_handler;
@@ -50,11 +59,25 @@ typedef struct device_mmio_t {
 	device_w64_handler_t w64_handler;
 } device_mmio_t;
 
+/* virtio_block_backend_t : enum of the ways the block device accesses its image, the data is always
+ *                          copied directly between the image and the host memory backing the guest RAM
+ */
+typedef enum virtio_block_backend_t {
+	VIRTIO_BLOCK_BACKEND_PREAD,  // pread(2) and pwrite(2) on the image file
+	VIRTIO_BLOCK_BACKEND_MMAP,   // shared mapping of the image file
+#ifdef RISCV_EMULATOR_IO_URING_SUPPORT
+	VIRTIO_BLOCK_BACKEND_IO_URING,         // asynchronous requests submitted to an io_uring
+	VIRTIO_BLOCK_BACKEND_IO_URING_DIRECT,  // same with the image opened with O_DIRECT to bypass the page cache
+#endif
+} virtio_block_backend_t;
+
 /* devices_create_virt_machine : create a simple "virt" style machine
  *                               returns true if all the devices were successfully created
- *     emulator_t* emu      : pointer to the emulator
- *     const char* hdd_file : file path to the HDD image
+ *     emulator_t* emu                    : pointer to the emulator
+ *     const char* hdd_file               : file path to the HDD image
+ *     virtio_block_backend_t hdd_backend : way the block device accesses the HDD image
+ *     uint32_t balloon_pages             : number of 4 KiB pages requested back by the balloon device
  */
-bool devices_create_virt_machine(emulator_t* emu, const char* hdd_file);
+bool devices_create_virt_machine(emulator_t* emu, const char* hdd_file, virtio_block_backend_t hdd_backend, uint32_t balloon_pages);
 
 #endif
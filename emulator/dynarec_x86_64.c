@@ -1,6 +1,7 @@
 #ifdef RISCV_EMULATOR_DYNAREC_X86_64_SUPPORT
 
 #include <assert.h>
+#include <endian.h>
 #include <inttypes.h>
 #include <stdbool.h>
 #include <stdio.h>
@@ -12,7 +13,7 @@
 #include "isa.h"
 
 static inline bool dr_emit_x86_code(emulator_t* emu, const dr_x86_code_t* x86_code, const ins_t* instruction, dr_block_t* block) {
-	if (block->pos + x86_code->code_size >= (DYNAREC_PAGE_SIZE - DYNAREC_PROLOGUE_SIZE)) {
+	if (block->pos + x86_code->code_size >= (block->data_pos - DYNAREC_PROLOGUE_SIZE)) {
 		return false;
 	}
 
@@ -37,7 +38,7 @@ static inline bool dr_emit_x86_code(emulator_t* emu, const dr_x86_code_t* x86_co
 	dr_ins_t* cached_instruction = &emu->cpu.instruction_cache.as_dr_ins[cache_index];
 
 	if (cached_instruction->native_code != NULL) {
-		if (cached_instruction->block_entry == block->base) {
+		if (DR_INS_BLOCK_ENTRY(cached_instruction) == block->base) {
 			/* The current block is too big to fit in the instruction cache and we're
 			 * looping back to an other instruction alread owned by this block
 			 */
@@ -47,9 +48,10 @@ static inline bool dr_emit_x86_code(emulator_t* emu, const dr_x86_code_t* x86_co
 		assert(cached_instruction->native_code == NULL);
 	}
 
-	cached_instruction->tag = block->pc;
-	cached_instruction->block_entry = block->base;
+	cached_instruction->tag = CPU_INSTRUCTION_CACHE_TAG(&emu->cpu, block->pc);
+	cached_instruction->block_offset = block->pc - block->base;
 	cached_instruction->native_code = block->page + block->pos;
+	cached_instruction->hits = dr_is_hot_code(emu, block->page) ? DYNAREC_HOT_THRESHOLD : 0;
 
 	block->pos += x86_code->code_size;
 
@@ -277,33 +279,345 @@ static inline bool dr_emit_type_j(emulator_t* emu, const ins_t* instruction, dr_
 #undef X_J
 }
 
-bool dr_emit_block(emulator_t* emu, guest_vaddr base) {
-	assert(emu->cpu.dynarec_enabled);
-	assert((base & 3) == 0);
+/* DR_IDIOM_STUB_SIZE : size of the code calling `dr_idiom_execute`
+ */
+#define DR_IDIOM_STUB_SIZE 14
 
-	uint8_t* page = mmap(NULL, DYNAREC_PAGE_SIZE, PROT_READ | PROT_WRITE,
-			     MAP_ANONYMOUS | MAP_PRIVATE, 0, 0);
-	if (page == MAP_FAILED) {
+static inline bool dr_idiom_find_induction(const dr_idiom_t* idiom, uint8_t reg, int64_t* step) {
+	for (size_t i = 0; i < idiom->induction_len; i++) {
+		if (idiom->induction_regs[i] == reg) {
+			*step = idiom->induction_steps[i];
+			return true;
+		}
+	}
+	return false;
+}
+
+/* DR_NO_LOOP_HEAD : value of a loop head when the next branch doesn't jump back to a recognizable loop
+ */
+#define DR_NO_LOOP_HEAD ((guest_vaddr)1)
+
+/* dr_scan_loop_head : scan the code up to the next control transfer instruction without leaving the
+ *                     RAM backed page of the instruction being emitted
+ *                     returns the address following the scanned instructions
+ *     emulator_t* emu        : pointer to the emulator
+ *     guest_vaddr vaddr      : guest virtual address of the instruction being emitted
+ *     guest_vaddr* loop_head : set to the target of the next instruction if it is a short backward branch,
+ *                              DR_NO_LOOP_HEAD otherwise
+ */
+static guest_vaddr dr_scan_loop_head(emulator_t* emu, guest_vaddr vaddr, guest_vaddr* loop_head) {
+	*loop_head = DR_NO_LOOP_HEAD;
+
+	// NOTE : the emitter already fetched from this page, the translation is cached in the ITLB
+	const uint8_t* code = emu_virtual_to_host(emu, vaddr, MMU_VG2PG_ACCESS_EXEC);
+	if (code == NULL) {
+		return vaddr + 4;
+	}
+
+	guest_vaddr page_end = (vaddr & MMU_VG2PG_PAGE_MASK) + MMU_VG2PG_PAGE_SIZE;
+	for (guest_vaddr pc = vaddr; pc != page_end; pc += 4, code += 4) {
+		ins_t instruction;
+		if (!cpu_decode(le32toh(*(const uint32_t*)code), &instruction)) {
+			return pc + 4;
+		}
+		if (instruction.type == INS_TYPE_B) {
+			if (instruction.imm < 0 && instruction.imm > -(int64_t)(DYNAREC_IDIOM_MAX_INSTRUCTIONS * 4)) {
+				*loop_head = pc + instruction.imm;
+			}
+			return pc + 4;
+		} else if (instruction.type == INS_TYPE_J ||
+			   instruction.opcode_switch == ((OPCODE_JALR >> 2) | (F3_JALR << 5))) {
+			return pc + 4;
+		}
+	}
+	return page_end;
+}
+
+static bool dr_recognize_idiom(const uint8_t* code, size_t code_len, guest_vaddr base, dr_idiom_t* idiom) {
+	ins_t body[DYNAREC_IDIOM_MAX_INSTRUCTIONS];
+	size_t body_len = 0;
+	while (1) {
+		if (body_len == DYNAREC_IDIOM_MAX_INSTRUCTIONS || body_len == code_len) {
+			return false;
+		}
+
+		uint32_t encoded_instruction = le32toh(*(const uint32_t*)(code + body_len * 4));
+		if (!cpu_decode(encoded_instruction, &body[body_len])) {
+			return false;
+		}
+		if (body[body_len].type == INS_TYPE_B) {
+			break;
+		}
+		body_len++;
+	}
+
+	const ins_t* branch = &body[body_len];
+	if (branch->imm != -(int64_t)(body_len * 4)) {
+		// The first branch of the block should loop back to its base
 		return false;
 	}
 
-	dr_block_t block = {
-		.page = page,
-		.pos = 0,
-		.base = base,
-		.pc = base,
-	};
+	memset(idiom, 0, sizeof(*idiom));
+	idiom->base = base;
+	idiom->instructions = body_len + 1;
+
+	const ins_t* load = NULL;
+	const ins_t* store = NULL;
+	size_t load_pos = 0, store_pos = 0;
+	size_t induction_pos[DYNAREC_IDIOM_MAX_INSTRUCTIONS];
+	uint32_t written_regs = 0;
+
+	for (size_t i = 0; i < body_len; i++) {
+		const ins_t* instruction = &body[i];
+		if (instruction->type == INS_TYPE_I &&
+		    instruction->opcode_switch == ((OPCODE_OP_IMM >> 2) | (F3_ADD << 5))) {
+			// Induction variables are only updated by a single `addi rd, rd, imm`
+			if (instruction->rd == 0 || instruction->rd != instruction->rs1 ||
+			    (written_regs & (1u << instruction->rd))) {
+				return false;
+			}
+			induction_pos[idiom->induction_len] = i;
+			idiom->induction_regs[idiom->induction_len] = instruction->rd;
+			idiom->induction_steps[idiom->induction_len] = instruction->imm;
+			idiom->induction_len++;
+			written_regs |= 1u << instruction->rd;
+		} else if (instruction->type == INS_TYPE_I &&
+			   (instruction->opcode_switch & 0x1f) == (OPCODE_LOAD >> 2)) {
+			if (load != NULL || instruction->rd == 0 || (written_regs & (1u << instruction->rd))) {
+				return false;
+			}
+			load = instruction;
+			load_pos = i;
+			written_regs |= 1u << instruction->rd;
+		} else if (instruction->type == INS_TYPE_S) {
+			if (store != NULL) {
+				return false;
+			}
+			store = instruction;
+			store_pos = i;
+		} else {
+			return false;
+		}
+	}
+
+	if (load != NULL && store != NULL) {
+		idiom->kind = DR_IDIOM_COPY;
+		if (store->rs2 != load->rd || store_pos < load_pos ||
+		    ((load->opcode_switch >> 5) & 3) != (store->opcode_switch >> 5)) {
+			return false;
+		}
+	} else if (store != NULL) {
+		idiom->kind = DR_IDIOM_FILL;
+		if (written_regs & (1u << store->rs2)) {
+			return false;
+		}
+	} else if (load != NULL) {
+		idiom->kind = DR_IDIOM_SCAN;
+		if (branch->opcode_switch != ((OPCODE_BRANCH >> 2) | (F3_BNE << 5)) ||
+		    !((branch->rs1 == load->rd && branch->rs2 == 0) ||
+		      (branch->rs1 == 0 && branch->rs2 == load->rd))) {
+			return false;
+		}
+	} else {
+		return false;
+	}
+
+	/* The memory accesses should use induction variables moving forward by the width of the
+	 * access, their offsets are relative to the value of the base register at the beginning
+	 * of the iteration
+	 */
+	if (load != NULL) {
+		uint8_t f3 = load->opcode_switch >> 5;
+		idiom->width = 1 << (f3 & 3);
+		idiom->load_signed = f3 < F3_LBU;
+		idiom->load_rd = load->rd;
+		idiom->load_rs1 = load->rs1;
+		idiom->load_offset = load->imm;
+
+		int64_t step;
+		if (!dr_idiom_find_induction(idiom, load->rs1, &step) || step != (int64_t)idiom->width) {
+			return false;
+		}
+		for (size_t i = 0; i < idiom->induction_len; i++) {
+			if (idiom->induction_regs[i] == load->rs1 && induction_pos[i] < load_pos) {
+				idiom->load_offset += step;
+			}
+		}
+	}
+	if (store != NULL) {
+		idiom->width = 1 << (store->opcode_switch >> 5);
+		idiom->store_rs1 = store->rs1;
+		idiom->store_rs2 = store->rs2;
+		idiom->store_offset = store->imm;
+
+		int64_t step;
+		if (!dr_idiom_find_induction(idiom, store->rs1, &step) || step != (int64_t)idiom->width ||
+		    (load != NULL && load->rs1 == store->rs1)) {
+			return false;
+		}
+		for (size_t i = 0; i < idiom->induction_len; i++) {
+			if (idiom->induction_regs[i] == store->rs1 && induction_pos[i] < store_pos) {
+				idiom->store_offset += step;
+			}
+		}
+	}
+
+	idiom->branch_opcode_switch = branch->opcode_switch;
+	idiom->branch_rs1 = branch->rs1;
+	idiom->branch_rs2 = branch->rs2;
+	if (idiom->kind == DR_IDIOM_SCAN) {
+		return true;
+	}
+
+	/* Otherwise the number of iterations should be computable from an induction variable
+	 * compared to a loop invariant
+	 */
+	int64_t step1 = 0, step2 = 0;
+	bool induction1 = dr_idiom_find_induction(idiom, branch->rs1, &step1);
+	bool induction2 = dr_idiom_find_induction(idiom, branch->rs2, &step2);
+	bool invariant1 = !(written_regs & (1u << branch->rs1));
+	bool invariant2 = !(written_regs & (1u << branch->rs2));
+	switch (branch->opcode_switch) {
+		case (OPCODE_BRANCH >> 2) | (F3_BNE << 5):
+			return (induction1 && step1 != 0 && invariant2) ||
+			       (invariant1 && induction2 && step2 != 0);
+		case (OPCODE_BRANCH >> 2) | (F3_BLT << 5):
+		case (OPCODE_BRANCH >> 2) | (F3_BLTU << 5):
+			return (induction1 && step1 > 0 && invariant2) ||
+			       (invariant1 && induction2 && step2 < 0);
+		default:
+			return false;
+	}
+}
+
+static bool dr_recognize_poll(const uint8_t* code, size_t code_len, guest_vaddr base, dr_idiom_t* idiom) {
+	uint32_t written_regs = 0, carried_regs = 0;
+	for (size_t i = 0; i < DYNAREC_IDIOM_MAX_INSTRUCTIONS && i < code_len; i++) {
+		ins_t instruction;
+		uint32_t encoded_instruction = le32toh(*(const uint32_t*)(code + i * 4));
+		if (!cpu_decode(encoded_instruction, &instruction)) {
+			return false;
+		}
+
+		/* Each iteration should only depend on the memory and on registers not modified by the
+		 * loop : a register read before being written in the iteration must be loop invariant
+		 */
+		uint32_t read_regs;
+		switch (instruction.opcode_switch & 0x1f) {
+			case OPCODE_LOAD >> 2:
+			case OPCODE_OP_IMM >> 2:
+			case OPCODE_OP_IMM_32 >> 2:
+				read_regs = 1u << instruction.rs1;
+				break;
+			case OPCODE_OP >> 2:
+			case OPCODE_OP_32 >> 2:
+			case OPCODE_BRANCH >> 2:
+				read_regs = (1u << instruction.rs1) | (1u << instruction.rs2);
+				break;
+			case OPCODE_LUI >> 2:
+			case OPCODE_AUIPC >> 2:
+				read_regs = 0;
+				break;
+			default:
+				return false;
+		}
+		carried_regs |= read_regs & ~written_regs;
+
+		if (instruction.type == INS_TYPE_B) {
+			if (instruction.imm != -(int64_t)(i * 4) || (carried_regs & written_regs & ~1u)) {
+				return false;
+			}
+			memset(idiom, 0, sizeof(*idiom));
+			idiom->base = base;
+			idiom->kind = DR_IDIOM_POLL;
+			idiom->instructions = i + 1;
+			return true;
+		}
+		written_regs |= 1u << instruction.rd;
+	}
+	return false;
+}
+
+static bool dr_emit_idiom(emulator_t* emu, dr_block_t* block) {
+	/* The loop body is read directly from the host memory, it never spans another page nor
+	 * touches MMIO devices
+	 */
+	const uint8_t* code = emu_virtual_to_host(emu, block->pc, MMU_VG2PG_ACCESS_EXEC);
+	if (code == NULL) {
+		return false;
+	}
+	size_t code_len = (MMU_VG2PG_PAGE_SIZE - (block->pc & MMU_VG2PG_OFFSET_MASK)) / 4;
+
+	dr_idiom_t idiom;
+	if (!dr_recognize_idiom(code, code_len, block->pc, &idiom) &&
+	    !dr_recognize_poll(code, code_len, block->pc, &idiom)) {
+		return false;
+	}
+
+	size_t data_pos = (block->data_pos - sizeof(idiom)) & ~7ull;
+	if (block->pos + DR_IDIOM_STUB_SIZE >= (data_pos - DYNAREC_PROLOGUE_SIZE)) {
+		return false;
+	}
+	block->data_pos = data_pos;
+	memcpy(&block->page[block->data_pos], &idiom, sizeof(idiom));
 
+	// mov rsi, imm64
+	block->page[block->pos++] = 0x48;
+	block->page[block->pos++] = 0xbe;
+	uint64_t idiom_addr = (uintptr_t)&block->page[block->data_pos];
+	memcpy(&block->page[block->pos], &idiom_addr, sizeof(idiom_addr));
+	block->pos += sizeof(idiom_addr);
+
+	// call [r11 - 4 * 8] (dr_idiom_execute_wrapper)
+	block->page[block->pos++] = 0x41;
+	block->page[block->pos++] = 0xff;
+	block->page[block->pos++] = 0x53;
+	block->page[block->pos++] = (uint8_t)(-4 * 8);
+
+	return true;
+}
+
+static inline size_t dr_code_page_index(guest_vaddr vaddr) {
+	return (vaddr >> MMU_VG2PG_PAGE_SHIFT) & ((1 << DYNAREC_CODE_PAGES_BITS) - 1);
+}
+
+static inline bool dr_is_code_page(emulator_t* emu, guest_vaddr vaddr) {
+	size_t index = dr_code_page_index(vaddr);
+	return (emu->cpu.dr_code_pages[index / 64] >> (index % 64)) & 1;
+}
+
+static void dr_mark_code_pages(emulator_t* emu, guest_vaddr first, guest_vaddr last) {
+	for (guest_vaddr page = first & MMU_VG2PG_PAGE_MASK;; page += MMU_VG2PG_PAGE_SIZE) {
+		size_t index = dr_code_page_index(page);
+		emu->cpu.dr_code_pages[index / 64] |= 1ull << (index % 64);
+
+		/* Stores to a page containing emitted code must go through `emu_wX` to invalidate
+		 * the instruction cache, we drop the write permission of the page cache entries
+		 */
+		for (size_t i = 0; i < REG_COUNT; i++) {
+			if (emu->cpu.dr_page_cache[i].write_tag == page) {
+				emu->cpu.dr_page_cache[i].write_tag = DYNAREC_PAGE_CACHE_INVALID_TAG;
+			}
+		}
+
+		if (page == (last & MMU_VG2PG_PAGE_MASK)) {
+			break;
+		}
+	}
+}
+
+static void dr_emit_instructions(emulator_t* emu, dr_block_t* block) {
+	guest_vaddr scanned_end = block->pc, loop_head = DR_NO_LOOP_HEAD;
 	bool cont = true;
 	while (cont) {
 		uint8_t exception_code;
 		guest_reg exception_tval;
-		uint32_t encoded_instruction = emu_r32_ins(emu, block.pc, &exception_code, &exception_tval);
+		uint32_t encoded_instruction = emu_r32_ins(emu, block->pc, &exception_code, &exception_tval);
 		if (exception_code != (uint8_t)-1) {
 			/* We don't throw an exception if we're not at the block base as it might
 			 * just be unreachable code
 			 */
-			if (block.pc == block.base) {
+			if (block->pc == block->base) {
 				cpu_throw_exception(emu, exception_code, exception_tval);
 			}
 			break;
@@ -314,24 +628,33 @@ bool dr_emit_block(emulator_t* emu, guest_vaddr base) {
 			break;
 		}
 
+		/* If the instruction is the head of a loop executable in bulk, its cache entry will
+		 * point to a stub calling the idiom helper right before its own code
+		 */
+		if (block->pc == scanned_end) {
+			scanned_end = dr_scan_loop_head(emu, block->pc, &loop_head);
+		}
+		size_t stub_pos = block->pos, stub_data_pos = block->data_pos;
+		bool has_idiom = block->pc == loop_head && dr_emit_idiom(emu, block);
+
 		switch (instruction.type) {
 			case INS_TYPE_R:
-				cont &= dr_emit_type_r(emu, &instruction, &block);
+				cont &= dr_emit_type_r(emu, &instruction, block);
 				break;
 			case INS_TYPE_I:
-				cont &= dr_emit_type_i(emu, &instruction, &block);
+				cont &= dr_emit_type_i(emu, &instruction, block);
 				break;
 			case INS_TYPE_S:
-				cont &= dr_emit_type_s(emu, &instruction, &block);
+				cont &= dr_emit_type_s(emu, &instruction, block);
 				break;
 			case INS_TYPE_B:
-				cont &= dr_emit_type_b(emu, &instruction, &block);
+				cont &= dr_emit_type_b(emu, &instruction, block);
 				break;
 			case INS_TYPE_U:
-				cont &= dr_emit_type_u(emu, &instruction, &block);
+				cont &= dr_emit_type_u(emu, &instruction, block);
 				break;
 			case INS_TYPE_J:
-				cont &= dr_emit_type_j(emu, &instruction, &block);
+				cont &= dr_emit_type_j(emu, &instruction, block);
 				break;
 			default:
 				fprintf(stderr, "Internal emulator error : invalid instruction type\n");
@@ -339,23 +662,60 @@ bool dr_emit_block(emulator_t* emu, guest_vaddr base) {
 				break;
 		}
 
+		if (has_idiom) {
+			size_t cache_index = (block->pc >> 2) & emu->cpu.instruction_cache_mask;
+			dr_ins_t* cached_instruction = &emu->cpu.instruction_cache.as_dr_ins[cache_index];
+			if (cached_instruction->tag == CPU_INSTRUCTION_CACHE_TAG(&emu->cpu, block->pc) &&
+			    cached_instruction->native_code == block->page + stub_pos + DR_IDIOM_STUB_SIZE) {
+				cached_instruction->native_code = block->page + stub_pos;
+			} else {
+				block->pos = stub_pos;
+				block->data_pos = stub_data_pos;
+			}
+		}
+
 		if (instruction.type == INS_TYPE_J ||
 		    instruction.opcode_switch == ((OPCODE_JALR >> 2) | (F3_JALR << 5))) {
 			break;
 		}
-		block.pc += 4;
+		block->pc += 4;
+	}
+}
+
+static void dr_emit_epilogue(emulator_t* emu, dr_block_t* block) {
+	assert(block->pos + DYNAREC_PROLOGUE_SIZE <= block->data_pos);
+	dr_mark_code_pages(emu, block->base, block->pc);
+
+	// jmp r10
+	block->page[block->pos++] = 0x41;
+	block->page[block->pos++] = 0xff;
+	block->page[block->pos++] = 0xe2;
+}
+
+bool dr_emit_block(emulator_t* emu, guest_vaddr base) {
+	assert(emu->cpu.dynarec_enabled);
+	assert((base & 3) == 0);
+
+	uint8_t* page = mmap(NULL, DYNAREC_PAGE_SIZE, PROT_READ | PROT_WRITE,
+			     MAP_ANONYMOUS | MAP_PRIVATE, 0, 0);
+	if (page == MAP_FAILED) {
+		return false;
 	}
 
+	dr_block_t block = {
+		.page = page,
+		.pos = 0,
+		.data_pos = DYNAREC_PAGE_SIZE,
+		.base = base,
+		.pc = base,
+	};
+	dr_emit_instructions(emu, &block);
+
 	if (block.pos == 0) {
 		munmap(block.page, DYNAREC_PAGE_SIZE);
 		return false;
 	}
-
-	assert(block.pos + DYNAREC_PROLOGUE_SIZE <= DYNAREC_PAGE_SIZE);
-	// jmp r10
-	block.page[block.pos + 0] = 0x41;
-	block.page[block.pos + 1] = 0xff;
-	block.page[block.pos + 2] = 0xe2;
+	dr_emit_epilogue(emu, &block);
 
 	if (mprotect(page, DYNAREC_PAGE_SIZE, PROT_READ | PROT_EXEC) < 0) {
 		perror("mprotect");
@@ -366,17 +726,387 @@ bool dr_emit_block(emulator_t* emu, guest_vaddr base) {
 	return true;
 }
 
+bool dr_is_hot_code(emulator_t* emu, const uint8_t* native_code) {
+	const dr_hot_region_t* hot = &emu->cpu.dr_hot_region;
+	return hot->base != NULL &&
+	       (uintptr_t)native_code - (uintptr_t)hot->base < DYNAREC_HOT_REGION_SIZE;
+}
+
+void dr_clear_hot_region(emulator_t* emu) {
+	emu->cpu.dr_hot_region.code_pos = 0;
+	emu->cpu.dr_hot_region.data_pos = DYNAREC_HOT_REGION_SIZE;
+}
+
+static void dr_hot_region_protect(emulator_t* emu, int prot) {
+	if (mprotect(emu->cpu.dr_hot_region.base, DYNAREC_HOT_REGION_SIZE, prot) < 0) {
+		perror("mprotect");
+		fprintf(stderr, "Internal emulator error : unable to change the protection of the hot region\n");
+		abort();
+	}
+}
+
+bool dr_emit_hot_block(emulator_t* emu, guest_vaddr base) {
+	assert(emu->cpu.dynarec_enabled);
+	assert((base & 3) == 0);
+
+	dr_hot_region_t* hot = &emu->cpu.dr_hot_region;
+	if (hot->base == NULL) {
+		uint8_t* region = mmap(NULL, DYNAREC_HOT_REGION_SIZE, PROT_READ | PROT_EXEC,
+				       MAP_ANONYMOUS | MAP_PRIVATE, 0, 0);
+		if (region == MAP_FAILED) {
+			return false;
+		}
+		hot->base = region;
+		dr_clear_hot_region(emu);
+	}
+
+	if (hot->data_pos - hot->code_pos < DYNAREC_PAGE_SIZE) {
+		/* The region is full, we start again from scratch : the blocks still hot will be
+		 * promoted again soon enough
+		 */
+		size_t instruction_cache_size = emu->cpu.instruction_cache_mask + 1;
+		for (size_t i = 0; i < instruction_cache_size; i++) {
+			dr_ins_t* cached_instruction = &emu->cpu.instruction_cache.as_dr_ins[i];
+			if (dr_is_hot_code(emu, cached_instruction->native_code)) {
+				cpu_invalidate_instruction_cache(emu, cached_instruction->tag);
+			}
+		}
+		dr_clear_hot_region(emu);
+	}
+
+	/* The block containing `base` is dropped first, otherwise we would consider its
+	 * instructions as part of the new block as they share the same entry
+	 */
+	cpu_invalidate_instruction_cache(emu, base);
+
+	// NOTE : the hot region is used like a big page : code grows upward and data downward
+	dr_block_t block = {
+		.page = hot->base,
+		.pos = hot->code_pos,
+		.data_pos = hot->data_pos,
+		.base = base,
+		.pc = base,
+	};
+
+	dr_hot_region_protect(emu, PROT_READ | PROT_WRITE);
+	dr_emit_instructions(emu, &block);
+	bool emitted = block.pos != hot->code_pos;
+	if (emitted) {
+		dr_emit_epilogue(emu, &block);
+
+		// We keep the blocks aligned on cache lines boundaries
+		hot->code_pos = (block.pos + DYNAREC_HOT_BLOCK_ALIGN - 1) & ~(DYNAREC_HOT_BLOCK_ALIGN - 1);
+		hot->data_pos = block.data_pos;
+		if (hot->code_pos > hot->data_pos) {
+			hot->code_pos = hot->data_pos;
+		}
+	}
+	dr_hot_region_protect(emu, PROT_READ | PROT_EXEC);
+
+	return emitted;
+}
+
+static bool dr_idiom_bulk_iterations(const dr_idiom_t* idiom, const guest_reg* regs, uint64_t* iterations) {
+	if (idiom->kind == DR_IDIOM_SCAN) {
+		// The number of iterations will be known while scanning the memory
+		*iterations = UINT64_MAX;
+		return true;
+	}
+
+	int64_t step;
+	bool rs1_is_induction = dr_idiom_find_induction(idiom, idiom->branch_rs1, &step);
+	if (!rs1_is_induction && !dr_idiom_find_induction(idiom, idiom->branch_rs2, &step)) {
+		return false;
+	}
+	uint64_t x = regs[rs1_is_induction ? idiom->branch_rs1 : idiom->branch_rs2];
+	uint64_t c = regs[rs1_is_induction ? idiom->branch_rs2 : idiom->branch_rs1];
+	uint64_t abs_step = step < 0 ? -(uint64_t)step : (uint64_t)step;
+
+	/* `total` is the number of iterations including the current one, i.e. the smallest n >= 1 such
+	 * as the branch isn't taken after the n-th iteration where the induction variable is x + n * step
+	 */
+	uint64_t total;
+	if (idiom->branch_opcode_switch == ((OPCODE_BRANCH >> 2) | (F3_BNE << 5))) {
+		uint64_t diff = step > 0 ? c - x : x - c;
+		if (diff % abs_step != 0 || diff == 0) {
+			// The loop would wrap around the address space, we don't even try
+			return false;
+		}
+		total = diff / abs_step;
+	} else {
+		if (idiom->branch_opcode_switch == ((OPCODE_BRANCH >> 2) | (F3_BLT << 5))) {
+			// Signed comparisons are turned into unsigned ones by flipping the sign bit
+			x ^= 1ull << 63;
+			c ^= 1ull << 63;
+		}
+		if (rs1_is_induction) {
+			// blt x, c : the induction variable is moving forward
+			total = x >= c ? 1 : (c - x - 1) / abs_step + 1;
+		} else {
+			// blt c, x : the induction variable is moving backward
+			total = x <= c ? 1 : (x - c - 1) / abs_step + 1;
+		}
+	}
+
+	*iterations = total - 1;
+	return true;
+}
+
+static inline uint64_t dr_idiom_host_read(const uint8_t* host_addr, size_t width, bool sign_extend) {
+	uint64_t value = 0;
+	memcpy(&value, host_addr, width);
+	value = le64toh(value);
+	if (sign_extend && width < sizeof(value)) {
+		uint64_t sign_bit = 1ull << (width * 8 - 1);
+		value = (value ^ sign_bit) - sign_bit;
+	}
+	return value;
+}
+
+static inline void dr_idiom_host_fill(uint8_t* host_addr, uint64_t value, size_t width, uint64_t count) {
+	const uint64_t width_mask = width == sizeof(value) ? UINT64_MAX : (1ull << (width * 8)) - 1;
+	if ((value & width_mask) == ((value & 0xff) * (UINT64_MAX / 0xff) & width_mask)) {
+		memset(host_addr, value & 0xff, count * width);
+		return;
+	}
+
+	value = htole64(value);
+	for (uint64_t i = 0; i < count; i++) {
+		memcpy(&host_addr[i * width], &value, width);
+	}
+}
+
+void dr_idiom_execute(emulator_t* emu, const dr_idiom_t* idiom_in_page) {
+	/* NOTE : the description of the loop is stored in the page of the block which might be
+	 *        unmapped if we invalidate it
+	 */
+	const dr_idiom_t idiom = *idiom_in_page;
+	if (idiom.kind == DR_IDIOM_POLL) {
+		/* The loop can't make progress by itself, once it has spun for a while we let the
+		 * host sleep until a device might change the memory or raise an interrupt
+		 */
+		if (emu->cpu.dr_self_loops >= DYNAREC_POLL_THRESHOLD) {
+			emu_idle(emu, DYNAREC_POLL_MAX_WAIT_NS);
+		}
+		return;
+	}
+
+	guest_reg* regs = emu->cpu.regs;
+	const uint64_t width = idiom.width;
+
+	uint64_t bulk_iterations;
+	if (!dr_idiom_bulk_iterations(&idiom, regs, &bulk_iterations)) {
+		return;
+	}
+	if (bulk_iterations > DYNAREC_IDIOM_MAX_BYTES / width) {
+		bulk_iterations = DYNAREC_IDIOM_MAX_BYTES / width;
+	}
+	// NOTE : the iterations executed in bulk are retired by the current block and count against its budget
+	if (bulk_iterations > emu->cpu.dr_idiom_budget / idiom.instructions) {
+		bulk_iterations = emu->cpu.dr_idiom_budget / idiom.instructions;
+	}
+
+	guest_vaddr src = regs[idiom.load_rs1] + idiom.load_offset;
+	guest_vaddr dst = regs[idiom.store_rs1] + idiom.store_offset;
+	if ((idiom.kind != DR_IDIOM_FILL && (src & (width - 1)) != 0) ||
+	    (idiom.kind != DR_IDIOM_SCAN && (dst & (width - 1)) != 0)) {
+		// Misaligned accesses are left to the emitted code
+		return;
+	}
+	if (idiom.kind == DR_IDIOM_COPY &&
+	    src < dst + bulk_iterations * width && dst < src + bulk_iterations * width) {
+		// Overlapping copies depend on the order of the accesses and are left to the emitted code
+		return;
+	}
+
+	uint64_t done = 0;
+	uint64_t last_value = 0;
+	bool invalidated = false;
+	bool stop = false;
+	while (done < bulk_iterations && !stop) {
+		guest_vaddr src_addr = src + done * width;
+		guest_vaddr dst_addr = dst + done * width;
+		uint64_t count = bulk_iterations - done;
+		uint8_t* src_host = NULL;
+		uint8_t* dst_host = NULL;
+
+		/* We translate each page once, if it isn't backed by RAM or if the access isn't allowed
+		 * we stop here and let the emitted code throw the exception or access the device
+		 */
+		if (idiom.kind != DR_IDIOM_FILL) {
+			src_host = emu_virtual_to_host(emu, src_addr, MMU_VG2PG_ACCESS_READ);
+			if (src_host == NULL) {
+				break;
+			}
+			uint64_t page_count = (MMU_VG2PG_PAGE_SIZE - (src_addr & MMU_VG2PG_OFFSET_MASK)) / width;
+			count = count < page_count ? count : page_count;
+		}
+		if (idiom.kind != DR_IDIOM_SCAN) {
+			dst_host = emu_virtual_to_host(emu, dst_addr, MMU_VG2PG_ACCESS_WRITE);
+			if (dst_host == NULL) {
+				break;
+			}
+			uint64_t page_count = (MMU_VG2PG_PAGE_SIZE - (dst_addr & MMU_VG2PG_OFFSET_MASK)) / width;
+			count = count < page_count ? count : page_count;
+		}
+
+		switch (idiom.kind) {
+			case DR_IDIOM_COPY:
+				if (src_host < dst_host + count * width && dst_host < src_host + count * width) {
+					// Two virtual pages might be aliased to the same physical page
+					stop = true;
+					count = 0;
+					break;
+				}
+				memcpy(dst_host, src_host, count * width);
+				last_value = dr_idiom_host_read(&src_host[(count - 1) * width], width, idiom.load_signed);
+				break;
+			case DR_IDIOM_FILL:
+				dr_idiom_host_fill(dst_host, regs[idiom.store_rs2], width, count);
+				break;
+			case DR_IDIOM_SCAN:
+				for (uint64_t i = 0; i < count; i++) {
+					if (dr_idiom_host_read(&src_host[i * width], width, false) == 0) {
+						// The iteration loading zero will be executed by the emitted code
+						stop = true;
+						count = i;
+						break;
+					}
+				}
+				if (count > 0) {
+					last_value = dr_idiom_host_read(&src_host[(count - 1) * width], width, idiom.load_signed);
+				}
+				break;
+			case DR_IDIOM_POLL:
+				fprintf(stderr, "Internal emulator error : spin-wait loop executed in bulk\n");
+				abort();
+				break;
+		}
+
+		if (idiom.kind != DR_IDIOM_SCAN) {
+			for (guest_vaddr addr = dst_addr & ~3; addr < dst_addr + count * width; addr += 4) {
+				invalidated |= cpu_invalidate_instruction_cache(emu, addr);
+			}
+		}
+		done += count;
+	}
+
+	if (done == 0) {
+		return;
+	}
+
+	for (size_t i = 0; i < idiom.induction_len; i++) {
+		regs[idiom.induction_regs[i]] += done * idiom.induction_steps[i];
+	}
+	if (idiom.kind != DR_IDIOM_FILL) {
+		regs[idiom.load_rd] = last_value;
+	}
+
+	/* NOTE : if the block was invalidated, the head of the loop is counted as retired by the short-circuit
+	 *        leaving the block while it is executed again
+	 */
+	emu->cpu.dr_idiom_retired += done * idiom.instructions - invalidated;
+	emu->cpu.dr_idiom_budget -= done * idiom.instructions;
+
+	if (invalidated) {
+		// The block might have been invalidated, we restart from the beginning of the loop
+		emu->cpu.pc = idiom.base;
+		emu->cpu.jump_pending = true;
+	}
+}
+
+void dr_flush_page_cache(emulator_t* emu) {
+	for (size_t i = 0; i < REG_COUNT; i++) {
+		emu->cpu.dr_page_cache[i].read_tag = DYNAREC_PAGE_CACHE_INVALID_TAG;
+		emu->cpu.dr_page_cache[i].write_tag = DYNAREC_PAGE_CACHE_INVALID_TAG;
+	}
+}
+
+void dr_flush_page_cache_writes(emulator_t* emu) {
+	for (size_t i = 0; i < REG_COUNT; i++) {
+		emu->cpu.dr_page_cache[i].write_tag = DYNAREC_PAGE_CACHE_INVALID_TAG;
+	}
+}
+
+static uint8_t* dr_page_cache_fill(emulator_t* emu, guest_vaddr vaddr, dr_page_cache_entry_t* entry, mmu_vg2pg_access_type_t access_type) {
+	guest_vaddr page = vaddr & MMU_VG2PG_PAGE_MASK;
+	if (access_type == MMU_VG2PG_ACCESS_WRITE && dr_is_code_page(emu, vaddr)) {
+		return NULL;
+	}
+
+	uint8_t* host_addr = emu_virtual_to_host(emu, vaddr, access_type);
+	if (host_addr == NULL) {
+		return NULL;
+	}
+
+	if (access_type == MMU_VG2PG_ACCESS_WRITE) {
+		// NOTE : a writable page is always readable, W=1 and R=0 is a reserved PTE encoding
+		entry->write_tag = page;
+		entry->read_tag = page;
+	} else {
+		if (entry->write_tag != page) {
+			entry->write_tag = DYNAREC_PAGE_CACHE_INVALID_TAG;
+		}
+		entry->read_tag = page;
+	}
+	entry->host_offset = (uintptr_t)host_addr - vaddr;
+	return host_addr;
+}
+
+#define le8toh(x) (x)
+#define htole8(x) (x)
+
+#define DR_PAGE_CACHE_RX(SIZE, TYPE)                                                                    \
+	TYPE dr_page_cache_r##SIZE(emulator_t* emu, guest_vaddr vaddr, dr_page_cache_entry_t* entry) { \
+		if ((vaddr & (sizeof(TYPE) - 1)) == 0) {                                                \
+			TYPE* host_addr = (TYPE*)dr_page_cache_fill(emu, vaddr, entry,                  \
+								    MMU_VG2PG_ACCESS_READ);             \
+			if (host_addr != NULL) {                                                        \
+				return le##SIZE##toh(*host_addr);                                       \
+			}                                                                               \
+		}                                                                                       \
+		return emu_r##SIZE(emu, vaddr);                                                         \
+	}
+
+#define DR_PAGE_CACHE_WX(SIZE, TYPE)                                                                                \
+	bool dr_page_cache_w##SIZE(emulator_t* emu, guest_vaddr vaddr, TYPE value, dr_page_cache_entry_t* entry) { \
+		if ((vaddr & (sizeof(TYPE) - 1)) == 0) {                                                            \
+			TYPE* host_addr = (TYPE*)dr_page_cache_fill(emu, vaddr, entry,                              \
+								    MMU_VG2PG_ACCESS_WRITE);                        \
+			if (host_addr != NULL) {                                                                    \
+				*host_addr = htole##SIZE(value);                                                    \
+				return false;                                                                       \
+			}                                                                                           \
+		}                                                                                                   \
+		return emu_w##SIZE(emu, vaddr, value);                                                              \
+	}
+
+DR_PAGE_CACHE_RX(64, uint64_t)
+DR_PAGE_CACHE_RX(32, uint32_t)
+DR_PAGE_CACHE_RX(16, uint16_t)
+DR_PAGE_CACHE_RX(8, uint8_t)
+DR_PAGE_CACHE_WX(64, uint64_t)
+DR_PAGE_CACHE_WX(32, uint32_t)
+DR_PAGE_CACHE_WX(16, uint16_t)
+DR_PAGE_CACHE_WX(8, uint8_t)
+
 void dr_free(emulator_t* emu) {
 	assert(emu->cpu.dynarec_enabled);
 
 	size_t instruction_cache_size = emu->cpu.instruction_cache_mask + 1;
 	for (size_t i = 0; i < instruction_cache_size; i++) {
 		dr_ins_t* cached_instruction = &emu->cpu.instruction_cache.as_dr_ins[i];
-		if (cached_instruction->native_code != NULL) {
+		if (cached_instruction->native_code != NULL &&
+		    !dr_is_hot_code(emu, cached_instruction->native_code)) {
 			uintptr_t page_base = (uintptr_t)cached_instruction->native_code & DYNAREC_PAGE_MASK;
 			munmap((void*)page_base, DYNAREC_PAGE_SIZE);
-			cached_instruction->native_code = NULL;
 		}
+		cached_instruction->native_code = NULL;
+	}
+
+	if (emu->cpu.dr_hot_region.base != NULL) {
+		munmap(emu->cpu.dr_hot_region.base, DYNAREC_HOT_REGION_SIZE);
+		emu->cpu.dr_hot_region.base = NULL;
 	}
 }
 
@@ -7,6 +7,7 @@
 #pragma GCC error "dynarec is only supported on x86-64"
 #endif
 
+#include <assert.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -42,10 +43,12 @@ typedef struct dr_x86_code_t {
 #define DYNAREC_PROLOGUE_SIZE 3
 
 /* dr_block_t : structure storing informations about a block of code being emitted
+ *              the data used by the emitted code is stored at the end of the page, starting at `data_pos`
  */
 typedef struct dr_block_t {
 	uint8_t* page;
 	size_t pos;
+	size_t data_pos;
 	guest_vaddr base;
 	guest_vaddr pc;
 } dr_block_t;
@@ -55,10 +58,129 @@ typedef struct dr_block_t {
  */
 typedef struct dr_ins_t {
 	guest_vaddr tag;
-	guest_vaddr block_entry;
 	uint8_t* native_code;
+	// NOTE : distance from the first instruction of the block owning the entry, see DR_INS_BLOCK_ENTRY
+	uint32_t block_offset;
+	// NOTE : number of times the instruction was used as an entry point, saturated at DYNAREC_HOT_THRESHOLD
+	uint32_t hits;
 } dr_ins_t;
 
+/* DR_INS_BLOCK_ENTRY : macro used to get the guest address of the first instruction of the block owning
+ *                      a dr_ins_t
+ */
+#define DR_INS_BLOCK_ENTRY(entry) (((entry)->tag & ~3ull) - (entry)->block_offset)
+
+/* DYNAREC_HOT_THRESHOLD : number of entries in a block after which it is emitted again in the
+ *                         hot region
+ */
+#define DYNAREC_HOT_THRESHOLD 1024
+
+/* DYNAREC_HOT_REGION_SIZE : size of the region of x86-64 code where the hot blocks are packed
+ *                           together to reduce the iTLB and L1i pressure
+ */
+#define DYNAREC_HOT_REGION_SIZE 0x100000
+
+/* DYNAREC_HOT_BLOCK_ALIGN : alignment of the blocks emitted in the hot region
+ */
+#define DYNAREC_HOT_BLOCK_ALIGN 16
+
+/* dr_hot_region_t : structure storing informations about the region where the hot blocks are
+ *                   emitted, like in a block page the code grows upward and the data downward
+ */
+typedef struct dr_hot_region_t {
+	uint8_t* base;
+	size_t code_pos;
+	size_t data_pos;
+} dr_hot_region_t;
+
+/* dr_page_cache_entry_t : structure storing the last guest page accessed through a base register
+ *                         by the emitted loads and stores, a tag is the base of a guest virtual page
+ *                         where the access is allowed, both tags refer to the page of `host_offset`
+ */
+typedef struct dr_page_cache_entry_t {
+	guest_vaddr read_tag;
+	guest_vaddr write_tag;
+	uintptr_t host_offset;  // host address - guest virtual address
+	uint64_t padding;
+} dr_page_cache_entry_t;
+
+// NOTE : the layout is hardcoded in the code generator (see PAGE_CACHE_X in dynarec_x86_64_codegen/codegen.h)
+static_assert(sizeof(dr_page_cache_entry_t) == (1 << 5) &&
+		      offsetof(dr_page_cache_entry_t, read_tag) == 0 &&
+		      offsetof(dr_page_cache_entry_t, write_tag) == 8 &&
+		      offsetof(dr_page_cache_entry_t, host_offset) == 16,
+	      "The layout of dr_page_cache_entry_t doesn't match the code generator");
+
+/* DYNAREC_PAGE_CACHE_INVALID_TAG : tag of an empty dr_page_cache_entry_t, it never matches as the
+ *                                  lower bits of a page base are always cleared
+ */
+#define DYNAREC_PAGE_CACHE_INVALID_TAG ((guest_vaddr)-1)
+
+/* DYNAREC_CODE_PAGES_BITS : number of bits of the hash of a guest virtual page in the bitmap of
+ *                           the pages containing emitted code
+ */
+#define DYNAREC_CODE_PAGES_BITS 14
+
+/* DYNAREC_CODE_PAGES_SIZE : number of uint64_t in the bitmap of the pages containing emitted code
+ */
+#define DYNAREC_CODE_PAGES_SIZE ((1 << DYNAREC_CODE_PAGES_BITS) / 64)
+
+/* DYNAREC_IDIOM_MAX_INSTRUCTIONS : maximum number of instructions (including the final branch)
+ *                                  of a loop body that can be recognized as an idiom
+ */
+#define DYNAREC_IDIOM_MAX_INSTRUCTIONS 8
+
+/* DYNAREC_IDIOM_MAX_BYTES : maximum number of bytes handled by a single call to the idiom helper
+ *                           this keeps the latency of interrupts and device updates bounded
+ */
+#define DYNAREC_IDIOM_MAX_BYTES 0x10000
+
+/* DYNAREC_POLL_THRESHOLD : number of consecutive iterations of a spin-wait loop before the emulator
+ *                          starts waiting for the devices instead of spinning
+ */
+#define DYNAREC_POLL_THRESHOLD 64
+
+/* DYNAREC_POLL_MAX_WAIT_NS : maximum time in nanoseconds waited for each iteration of a spin-wait loop
+ *                            once the threshold is reached
+ */
+#define DYNAREC_POLL_MAX_WAIT_NS 100000  // 100us
+
+/* dr_idiom_kind_t : enum of the kinds of loops that can be executed in bulk
+ */
+typedef enum dr_idiom_kind_t {
+	DR_IDIOM_COPY,  // memcpy-like loop : a load and a store of the loaded value
+	DR_IDIOM_FILL,  // memset-like loop : a store of a loop invariant value
+	DR_IDIOM_SCAN,  // strlen-like loop : a load and a branch until the loaded value is zero
+	DR_IDIOM_POLL,  // spin-wait loop   : loads and computations without side effects nor loop carried state
+} dr_idiom_kind_t;
+
+/* dr_idiom_t : structure describing a recognized loop, it is stored in the data of the block
+ *              containing the loop
+ */
+typedef struct dr_idiom_t {
+	guest_vaddr base;
+	dr_idiom_kind_t kind;
+	size_t instructions;  // number of instructions of an iteration, including the branch
+	size_t width;
+	bool load_signed;
+
+	uint8_t load_rd;
+	uint8_t load_rs1;
+	int64_t load_offset;
+	uint8_t store_rs1;
+	uint8_t store_rs2;
+	int64_t store_offset;
+
+	// NOTE : the branch is either BNE, BLT or BLTU and is taken to loop back to `base`
+	uint16_t branch_opcode_switch;
+	uint8_t branch_rs1;
+	uint8_t branch_rs2;
+
+	size_t induction_len;
+	uint8_t induction_regs[DYNAREC_IDIOM_MAX_INSTRUCTIONS];
+	int64_t induction_steps[DYNAREC_IDIOM_MAX_INSTRUCTIONS];
+} dr_idiom_t;
+
 // NOTE : forward declaration to deal with a cyclic dependency with emulator.h
 typedef struct emulator_t emulator_t;
 
@@ -70,19 +192,102 @@ typedef struct emulator_t emulator_t;
  */
 bool dr_emit_block(emulator_t* emu, guest_vaddr base);
 
+/* dr_emit_hot_block : emit a block of x86-64 code in the hot region, the block previously
+ *                     containing the instruction at `base` is invalidated
+ *                     returns true if some x86-64 code was added to the instruction cache
+ *                     returns false otherwise
+ *     emulator_t* emu  : pointer to the emulator
+ *     guest_vaddr base : base RISC-V program counter of the block to emit
+ */
+bool dr_emit_hot_block(emulator_t* emu, guest_vaddr base);
+
+/* dr_is_hot_code : check if some emitted code is stored in the hot region, such code is not
+ *                  stored in its own page and shouldn't be unmapped
+ *     emulator_t* emu            : pointer to the emulator
+ *     const uint8_t* native_code : pointer to the emitted code
+ */
+bool dr_is_hot_code(emulator_t* emu, const uint8_t* native_code);
+
+/* dr_clear_hot_region : mark the whole hot region as free, all the entries of the instruction
+ *                       cache pointing to it should have been invalidated
+ *     emulator_t* emu : pointer to the emulator
+ */
+void dr_clear_hot_region(emulator_t* emu);
+
+/* dr_idiom_execute : execute in bulk some iterations of a recognized loop, this function is
+ *                    called by the dynarec code at the beginning of the loop and always leaves
+ *                    at least the last iteration to the emitted code
+ *     emulator_t* emu         : pointer to the emulator
+ *     const dr_idiom_t* idiom : pointer to the description of the loop
+ */
+void dr_idiom_execute(emulator_t* emu, const dr_idiom_t* idiom);
+
+/* dr_flush_page_cache : invalidate all the entries of the page cache used by the emitted loads
+ *                       and stores, it should be called when the guest virtual memory mapping or
+ *                       the permissions of the current privilege mode change
+ *     emulator_t* emu : pointer to the emulator
+ */
+void dr_flush_page_cache(emulator_t* emu);
+
+/* dr_flush_page_cache_writes : invalidate the write permission of all the entries of the page cache, the emitted
+ *                              stores go through dr_page_cache_wX on their next access to each page
+ *     emulator_t* emu : pointer to the emulator
+ */
+void dr_flush_page_cache_writes(emulator_t* emu);
+
+/* dr_page_cache_rX : read a X-bit value in guest virtual memory and fill the page cache
+ *                    entry of the base register on success, it is called by the emitted
+ *                    code on a page cache miss
+ *     emulator_t* emu               : pointer to the emulator
+ *     guest_vaddr vaddr             : guest virtual address to read
+ *     dr_page_cache_entry_t* entry  : page cache entry of the base register
+ */
+uint8_t dr_page_cache_r8(emulator_t* emu, guest_vaddr vaddr, dr_page_cache_entry_t* entry);
+uint16_t dr_page_cache_r16(emulator_t* emu, guest_vaddr vaddr, dr_page_cache_entry_t* entry);
+uint32_t dr_page_cache_r32(emulator_t* emu, guest_vaddr vaddr, dr_page_cache_entry_t* entry);
+uint64_t dr_page_cache_r64(emulator_t* emu, guest_vaddr vaddr, dr_page_cache_entry_t* entry);
+
+/* dr_page_cache_wX : write a X-bit value in guest virtual memory and fill the page cache
+ *                    entry of the base register on success, it is called by the emitted
+ *                    code on a page cache miss
+ *                    returns true if some entries in the instruction cache were invalidated
+ *                    returns false otherwise
+ *     emulator_t* emu               : pointer to the emulator
+ *     guest_vaddr vaddr             : guest virtual address to write
+ *     uintX_t value                 : value to write
+ *     dr_page_cache_entry_t* entry  : page cache entry of the base register
+ */
+bool dr_page_cache_w8(emulator_t* emu, guest_vaddr vaddr, uint8_t value, dr_page_cache_entry_t* entry);
+bool dr_page_cache_w16(emulator_t* emu, guest_vaddr vaddr, uint16_t value, dr_page_cache_entry_t* entry);
+bool dr_page_cache_w32(emulator_t* emu, guest_vaddr vaddr, uint32_t value, dr_page_cache_entry_t* entry);
+bool dr_page_cache_w64(emulator_t* emu, guest_vaddr vaddr, uint64_t value, dr_page_cache_entry_t* entry);
+
 /* dr_free : free all the allocated pages still used by the instruction cache
  *     emulator_t* emu : pointer to the emulator
  */
 void dr_free(emulator_t* emu);
 
+/* DR_NO_EXIT_INSTRUCTION : value of `dr_exit_t.exit_pc` when the emitted code ran up to the end of its block
+ */
+#define DR_NO_EXIT_INSTRUCTION ((guest_reg)1)
+
+/* dr_exit_t : structure returned by `dr_entry`, it is returned in RAX and RDX by the System V ABI
+ */
+typedef struct dr_exit_t {
+	guest_reg pc;
+	// NOTE : address of the jump, branch or emulator call leaving the block, DR_NO_EXIT_INSTRUCTION otherwise
+	guest_reg exit_pc;
+} dr_exit_t;
+
 /* dr_entry : enter dynarec code
- *            returns the new RISC-V program counter
- *     emulator_t* emu   : pointer to the emulator
- *     void* native_code : pointer to the emitted native code
- *     guest_reg* regs   : pointer to the RISC-V register array
- *     guest_reg pc      : current PC
+ *            returns the new RISC-V program counter and the address of the instruction leaving the block
+ *     emulator_t* emu                   : pointer to the emulator
+ *     void* native_code                 : pointer to the emitted native code
+ *     guest_reg* regs                   : pointer to the RISC-V register array
+ *     guest_reg pc                      : current PC
+ *     dr_page_cache_entry_t* page_cache : pointer to the page cache, indexed by base register
  */
-guest_reg dr_entry(emulator_t* emu, void* native_code, guest_reg* regs, guest_reg pc);
+dr_exit_t dr_entry(emulator_t* emu, void* native_code, guest_reg* regs, guest_reg pc, dr_page_cache_entry_t* page_cache);
 
 /* DR_X86_X : dr_x86_code_t corresponding to the RISC-V instruction X
  *            these arrays are generated by the code generator in dynarec_x86_64_codegen/
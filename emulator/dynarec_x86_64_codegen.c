@@ -0,0 +1,744 @@
+#include "dynarec_x86_64.h"
+
+const dr_x86_code_t DR_X86_ADD[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x03\x40\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, 7, 11, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x03\x40\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, 7, 11, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x03\x40\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, 7, 11, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x03\x40\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, 7, 11, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_SUB[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x2b\x40\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, 7, 11, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x2b\x40\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, 7, 11, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x2b\x40\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, 7, 11, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x2b\x40\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, 7, 11, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_SLL[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x3f\x00\x00\x00\x48\xd3\xe0\x49\x89\x40\x00\x49\x83\xc1\x04", 26, 3, 7, 21, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x3f\x00\x00\x00\x48\xd3\xe0\x49\x89\x40\x00\x49\x83\xc1\x04", 26, 3, 7, 21, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x3f\x00\x00\x00\x48\xd3\xe0\x49\x89\x40\x00\x49\x83\xc1\x04", 26, 3, 7, 21, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x3f\x00\x00\x00\x48\xd3\xe0\x49\x89\x40\x00\x49\x83\xc1\x04", 26, 3, 7, 21, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_SLT[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x31\xc9\x49\x3b\x40\x00\x0f\x9c\xc1\x49\x89\x48\x00\x49\x83\xc1\x04", 22, 3, 10, 17, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x31\xc9\x49\x3b\x40\x00\x0f\x9c\xc1\x49\x89\x48\x00\x49\x83\xc1\x04", 22, 3, 10, 17, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x31\xc9\x49\x3b\x40\x00\x0f\x9c\xc1\x49\x89\x48\x00\x49\x83\xc1\x04", 22, 3, 10, 17, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x31\xc9\x49\x3b\x40\x00\x0f\x9c\xc1\x49\x89\x48\x00\x49\x83\xc1\x04", 22, 3, 10, 17, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_SLTU[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x31\xc9\x49\x3b\x40\x00\x0f\x92\xc1\x49\x89\x48\x00\x49\x83\xc1\x04", 22, 3, 10, 17, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x31\xc9\x49\x3b\x40\x00\x0f\x92\xc1\x49\x89\x48\x00\x49\x83\xc1\x04", 22, 3, 10, 17, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x31\xc9\x49\x3b\x40\x00\x0f\x92\xc1\x49\x89\x48\x00\x49\x83\xc1\x04", 22, 3, 10, 17, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x31\xc9\x49\x3b\x40\x00\x0f\x92\xc1\x49\x89\x48\x00\x49\x83\xc1\x04", 22, 3, 10, 17, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_XOR[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x33\x40\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, 7, 11, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x33\x40\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, 7, 11, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x33\x40\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, 7, 11, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x33\x40\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, 7, 11, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_SRL[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x3f\x00\x00\x00\x48\xd3\xe8\x49\x89\x40\x00\x49\x83\xc1\x04", 26, 3, 7, 21, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x3f\x00\x00\x00\x48\xd3\xe8\x49\x89\x40\x00\x49\x83\xc1\x04", 26, 3, 7, 21, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x3f\x00\x00\x00\x48\xd3\xe8\x49\x89\x40\x00\x49\x83\xc1\x04", 26, 3, 7, 21, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x3f\x00\x00\x00\x48\xd3\xe8\x49\x89\x40\x00\x49\x83\xc1\x04", 26, 3, 7, 21, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_SRA[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x3f\x00\x00\x00\x48\xd3\xf8\x49\x89\x40\x00\x49\x83\xc1\x04", 26, 3, 7, 21, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x3f\x00\x00\x00\x48\xd3\xf8\x49\x89\x40\x00\x49\x83\xc1\x04", 26, 3, 7, 21, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x3f\x00\x00\x00\x48\xd3\xf8\x49\x89\x40\x00\x49\x83\xc1\x04", 26, 3, 7, 21, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x3f\x00\x00\x00\x48\xd3\xf8\x49\x89\x40\x00\x49\x83\xc1\x04", 26, 3, 7, 21, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_OR[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x0b\x40\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, 7, 11, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x0b\x40\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, 7, 11, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x0b\x40\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, 7, 11, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x0b\x40\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, 7, 11, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_AND[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x23\x40\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, 7, 11, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x23\x40\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, 7, 11, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x23\x40\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, 7, 11, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x23\x40\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, 7, 11, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_ADDW[] = {
+	[0] = {(uint8_t*)"\x41\x8b\x40\x00\x49\x03\x40\x00\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 19, 3, 7, 14, -1, -1},
+	[1] = {(uint8_t*)"\x41\x8b\x40\x00\x49\x03\x40\x00\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 19, 3, 7, 14, -1, -1},
+	[2] = {(uint8_t*)"\x41\x8b\x40\x00\x49\x03\x40\x00\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 19, 3, 7, 14, -1, -1},
+	[3] = {(uint8_t*)"\x41\x8b\x40\x00\x49\x03\x40\x00\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 19, 3, 7, 14, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_SUBW[] = {
+	[0] = {(uint8_t*)"\x41\x8b\x40\x00\x49\x2b\x40\x00\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 19, 3, 7, 14, -1, -1},
+	[1] = {(uint8_t*)"\x41\x8b\x40\x00\x49\x2b\x40\x00\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 19, 3, 7, 14, -1, -1},
+	[2] = {(uint8_t*)"\x41\x8b\x40\x00\x49\x2b\x40\x00\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 19, 3, 7, 14, -1, -1},
+	[3] = {(uint8_t*)"\x41\x8b\x40\x00\x49\x2b\x40\x00\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 19, 3, 7, 14, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_SLLW[] = {
+	[0] = {(uint8_t*)"\x41\x8b\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x1f\x00\x00\x00\x48\xd3\xe0\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 29, 3, 7, 24, -1, -1},
+	[1] = {(uint8_t*)"\x41\x8b\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x1f\x00\x00\x00\x48\xd3\xe0\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 29, 3, 7, 24, -1, -1},
+	[2] = {(uint8_t*)"\x41\x8b\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x1f\x00\x00\x00\x48\xd3\xe0\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 29, 3, 7, 24, -1, -1},
+	[3] = {(uint8_t*)"\x41\x8b\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x1f\x00\x00\x00\x48\xd3\xe0\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 29, 3, 7, 24, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_SRLW[] = {
+	[0] = {(uint8_t*)"\x41\x8b\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x1f\x00\x00\x00\x48\xd3\xe8\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 29, 3, 7, 24, -1, -1},
+	[1] = {(uint8_t*)"\x41\x8b\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x1f\x00\x00\x00\x48\xd3\xe8\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 29, 3, 7, 24, -1, -1},
+	[2] = {(uint8_t*)"\x41\x8b\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x1f\x00\x00\x00\x48\xd3\xe8\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 29, 3, 7, 24, -1, -1},
+	[3] = {(uint8_t*)"\x41\x8b\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x1f\x00\x00\x00\x48\xd3\xe8\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 29, 3, 7, 24, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_SRAW[] = {
+	[0] = {(uint8_t*)"\x49\x63\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x1f\x00\x00\x00\x48\xd3\xf8\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 29, 3, 7, 24, -1, -1},
+	[1] = {(uint8_t*)"\x49\x63\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x1f\x00\x00\x00\x48\xd3\xf8\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 29, 3, 7, 24, -1, -1},
+	[2] = {(uint8_t*)"\x49\x63\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x1f\x00\x00\x00\x48\xd3\xf8\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 29, 3, 7, 24, -1, -1},
+	[3] = {(uint8_t*)"\x49\x63\x40\x00\x49\x8b\x48\x00\x48\x81\xe1\x1f\x00\x00\x00\x48\xd3\xf8\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 29, 3, 7, 24, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_MUL[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x50\x00\x48\xf7\xe2\x49\x89\x40\x00\x49\x83\xc1\x04", 19, 3, 7, 14, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x50\x00\x48\xf7\xe2\x49\x89\x40\x00\x49\x83\xc1\x04", 19, 3, 7, 14, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x50\x00\x48\xf7\xe2\x49\x89\x40\x00\x49\x83\xc1\x04", 19, 3, 7, 14, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x50\x00\x48\xf7\xe2\x49\x89\x40\x00\x49\x83\xc1\x04", 19, 3, 7, 14, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_MULH[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x50\x00\x48\xf7\xea\x49\x89\x50\x00\x49\x83\xc1\x04", 19, 3, 7, 14, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x50\x00\x48\xf7\xea\x49\x89\x50\x00\x49\x83\xc1\x04", 19, 3, 7, 14, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x50\x00\x48\xf7\xea\x49\x89\x50\x00\x49\x83\xc1\x04", 19, 3, 7, 14, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x50\x00\x48\xf7\xea\x49\x89\x50\x00\x49\x83\xc1\x04", 19, 3, 7, 14, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_MULHSU[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x78\x00\x48\x89\xf0\x48\xf7\xe7\x48\x89\xd1\x48\x89\xf0\x48\xc1\xf8\x3f\x48\xf7\xef\x48\x01\xc1\x49\x89\x48\x00\x49\x83\xc1\x04", 38, 3, 7, 33, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x78\x00\x48\x89\xf0\x48\xf7\xe7\x48\x89\xd1\x48\x89\xf0\x48\xc1\xf8\x3f\x48\xf7\xef\x48\x01\xc1\x49\x89\x48\x00\x49\x83\xc1\x04", 38, 3, 7, 33, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x78\x00\x48\x89\xf0\x48\xf7\xe7\x48\x89\xd1\x48\x89\xf0\x48\xc1\xf8\x3f\x48\xf7\xef\x48\x01\xc1\x49\x89\x48\x00\x49\x83\xc1\x04", 38, 3, 7, 33, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x78\x00\x48\x89\xf0\x48\xf7\xe7\x48\x89\xd1\x48\x89\xf0\x48\xc1\xf8\x3f\x48\xf7\xef\x48\x01\xc1\x49\x89\x48\x00\x49\x83\xc1\x04", 38, 3, 7, 33, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_MULHU[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x50\x00\x48\xf7\xe2\x49\x89\x50\x00\x49\x83\xc1\x04", 19, 3, 7, 14, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x50\x00\x48\xf7\xe2\x49\x89\x50\x00\x49\x83\xc1\x04", 19, 3, 7, 14, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x50\x00\x48\xf7\xe2\x49\x89\x50\x00\x49\x83\xc1\x04", 19, 3, 7, 14, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x50\x00\x48\xf7\xe2\x49\x89\x50\x00\x49\x83\xc1\x04", 19, 3, 7, 14, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_DIV[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x78\x00\x48\x85\xff\x74\x21\x48\x81\xff\xff\xff\xff\xff\x75\x0e\xb8\x01\x00\x00\x00\x48\xc1\xe0\x3f\x48\x39\xc6\x74\x10\x48\x89\xf0\x48\x99\x48\xf7\xff\xeb\x06\x48\x0d\xff\xff\xff\xff\x49\x89\x40\x00\x49\x83\xc1\x04", 60, 3, 7, 55, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x78\x00\x48\x85\xff\x74\x21\x48\x81\xff\xff\xff\xff\xff\x75\x0e\xb8\x01\x00\x00\x00\x48\xc1\xe0\x3f\x48\x39\xc6\x74\x10\x48\x89\xf0\x48\x99\x48\xf7\xff\xeb\x06\x48\x0d\xff\xff\xff\xff\x49\x89\x40\x00\x49\x83\xc1\x04", 60, 3, 7, 55, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x78\x00\x48\x85\xff\x74\x21\x48\x81\xff\xff\xff\xff\xff\x75\x0e\xb8\x01\x00\x00\x00\x48\xc1\xe0\x3f\x48\x39\xc6\x74\x10\x48\x89\xf0\x48\x99\x48\xf7\xff\xeb\x06\x48\x0d\xff\xff\xff\xff\x49\x89\x40\x00\x49\x83\xc1\x04", 60, 3, 7, 55, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x78\x00\x48\x85\xff\x74\x21\x48\x81\xff\xff\xff\xff\xff\x75\x0e\xb8\x01\x00\x00\x00\x48\xc1\xe0\x3f\x48\x39\xc6\x74\x10\x48\x89\xf0\x48\x99\x48\xf7\xff\xeb\x06\x48\x0d\xff\xff\xff\xff\x49\x89\x40\x00\x49\x83\xc1\x04", 60, 3, 7, 55, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_DIVU[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x78\x00\x48\x85\xff\x74\x08\x48\x31\xd2\x48\xf7\xf7\xeb\x06\x48\x0d\xff\xff\xff\xff\x49\x89\x40\x00\x49\x83\xc1\x04", 35, 3, 7, 30, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x78\x00\x48\x85\xff\x74\x08\x48\x31\xd2\x48\xf7\xf7\xeb\x06\x48\x0d\xff\xff\xff\xff\x49\x89\x40\x00\x49\x83\xc1\x04", 35, 3, 7, 30, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x78\x00\x48\x85\xff\x74\x08\x48\x31\xd2\x48\xf7\xf7\xeb\x06\x48\x0d\xff\xff\xff\xff\x49\x89\x40\x00\x49\x83\xc1\x04", 35, 3, 7, 30, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x78\x00\x48\x85\xff\x74\x08\x48\x31\xd2\x48\xf7\xf7\xeb\x06\x48\x0d\xff\xff\xff\xff\x49\x89\x40\x00\x49\x83\xc1\x04", 35, 3, 7, 30, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_REM[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x78\x00\x48\x85\xff\x74\x25\x48\x81\xff\xff\xff\xff\xff\x75\x0e\xb8\x01\x00\x00\x00\x48\xc1\xe0\x3f\x48\x39\xc6\x74\x0a\x48\x89\xf0\x48\x99\x48\xf7\xff\xeb\x07\x48\xc1\xe6\x01\x48\x89\xf2\x49\x89\x50\x00\x49\x83\xc1\x04", 61, 3, 7, 56, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x78\x00\x48\x85\xff\x74\x25\x48\x81\xff\xff\xff\xff\xff\x75\x0e\xb8\x01\x00\x00\x00\x48\xc1\xe0\x3f\x48\x39\xc6\x74\x0a\x48\x89\xf0\x48\x99\x48\xf7\xff\xeb\x07\x48\xc1\xe6\x01\x48\x89\xf2\x49\x89\x50\x00\x49\x83\xc1\x04", 61, 3, 7, 56, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x78\x00\x48\x85\xff\x74\x25\x48\x81\xff\xff\xff\xff\xff\x75\x0e\xb8\x01\x00\x00\x00\x48\xc1\xe0\x3f\x48\x39\xc6\x74\x0a\x48\x89\xf0\x48\x99\x48\xf7\xff\xeb\x07\x48\xc1\xe6\x01\x48\x89\xf2\x49\x89\x50\x00\x49\x83\xc1\x04", 61, 3, 7, 56, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x78\x00\x48\x85\xff\x74\x25\x48\x81\xff\xff\xff\xff\xff\x75\x0e\xb8\x01\x00\x00\x00\x48\xc1\xe0\x3f\x48\x39\xc6\x74\x0a\x48\x89\xf0\x48\x99\x48\xf7\xff\xeb\x07\x48\xc1\xe6\x01\x48\x89\xf2\x49\x89\x50\x00\x49\x83\xc1\x04", 61, 3, 7, 56, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_REMU[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x78\x00\x48\x85\xff\x74\x08\x48\x31\xd2\x48\xf7\xf7\xeb\x03\x48\x89\xc2\x49\x89\x50\x00\x49\x83\xc1\x04", 32, 3, 7, 27, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x78\x00\x48\x85\xff\x74\x08\x48\x31\xd2\x48\xf7\xf7\xeb\x03\x48\x89\xc2\x49\x89\x50\x00\x49\x83\xc1\x04", 32, 3, 7, 27, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x78\x00\x48\x85\xff\x74\x08\x48\x31\xd2\x48\xf7\xf7\xeb\x03\x48\x89\xc2\x49\x89\x50\x00\x49\x83\xc1\x04", 32, 3, 7, 27, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x8b\x78\x00\x48\x85\xff\x74\x08\x48\x31\xd2\x48\xf7\xf7\xeb\x03\x48\x89\xc2\x49\x89\x50\x00\x49\x83\xc1\x04", 32, 3, 7, 27, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_MULW[] = {
+	[0] = {(uint8_t*)"\x49\x63\x40\x00\x49\x63\x50\x00\x48\xf7\xe2\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 22, 3, 7, 17, -1, -1},
+	[1] = {(uint8_t*)"\x49\x63\x40\x00\x49\x63\x50\x00\x48\xf7\xe2\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 22, 3, 7, 17, -1, -1},
+	[2] = {(uint8_t*)"\x49\x63\x40\x00\x49\x63\x50\x00\x48\xf7\xe2\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 22, 3, 7, 17, -1, -1},
+	[3] = {(uint8_t*)"\x49\x63\x40\x00\x49\x63\x50\x00\x48\xf7\xe2\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 22, 3, 7, 17, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_DIVW[] = {
+	[0] = {(uint8_t*)"\x49\x63\x70\x00\x49\x63\x78\x00\x48\x85\xff\x74\x27\x48\x81\xff\xff\xff\xff\xff\x75\x11\xb8\x01\x00\x00\x00\x48\xc1\xe0\x1f\x48\x63\xc0\x48\x39\xc6\x74\x13\x48\x89\xf0\x48\x99\x48\xf7\xff\x48\x63\xc0\xeb\x06\x48\x0d\xff\xff\xff\xff\x49\x89\x40\x00\x49\x83\xc1\x04", 66, 3, 7, 61, -1, -1},
+	[1] = {(uint8_t*)"\x49\x63\x70\x00\x49\x63\x78\x00\x48\x85\xff\x74\x27\x48\x81\xff\xff\xff\xff\xff\x75\x11\xb8\x01\x00\x00\x00\x48\xc1\xe0\x1f\x48\x63\xc0\x48\x39\xc6\x74\x13\x48\x89\xf0\x48\x99\x48\xf7\xff\x48\x63\xc0\xeb\x06\x48\x0d\xff\xff\xff\xff\x49\x89\x40\x00\x49\x83\xc1\x04", 66, 3, 7, 61, -1, -1},
+	[2] = {(uint8_t*)"\x49\x63\x70\x00\x49\x63\x78\x00\x48\x85\xff\x74\x27\x48\x81\xff\xff\xff\xff\xff\x75\x11\xb8\x01\x00\x00\x00\x48\xc1\xe0\x1f\x48\x63\xc0\x48\x39\xc6\x74\x13\x48\x89\xf0\x48\x99\x48\xf7\xff\x48\x63\xc0\xeb\x06\x48\x0d\xff\xff\xff\xff\x49\x89\x40\x00\x49\x83\xc1\x04", 66, 3, 7, 61, -1, -1},
+	[3] = {(uint8_t*)"\x49\x63\x70\x00\x49\x63\x78\x00\x48\x85\xff\x74\x27\x48\x81\xff\xff\xff\xff\xff\x75\x11\xb8\x01\x00\x00\x00\x48\xc1\xe0\x1f\x48\x63\xc0\x48\x39\xc6\x74\x13\x48\x89\xf0\x48\x99\x48\xf7\xff\x48\x63\xc0\xeb\x06\x48\x0d\xff\xff\xff\xff\x49\x89\x40\x00\x49\x83\xc1\x04", 66, 3, 7, 61, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_DIVUW[] = {
+	[0] = {(uint8_t*)"\x41\x8b\x40\x00\x41\x8b\x78\x00\x48\x85\xff\x74\x0b\x48\x31\xd2\x48\xf7\xf7\x48\x63\xc0\xeb\x06\x48\x0d\xff\xff\xff\xff\x49\x89\x40\x00\x49\x83\xc1\x04", 38, 3, 7, 33, -1, -1},
+	[1] = {(uint8_t*)"\x41\x8b\x40\x00\x41\x8b\x78\x00\x48\x85\xff\x74\x0b\x48\x31\xd2\x48\xf7\xf7\x48\x63\xc0\xeb\x06\x48\x0d\xff\xff\xff\xff\x49\x89\x40\x00\x49\x83\xc1\x04", 38, 3, 7, 33, -1, -1},
+	[2] = {(uint8_t*)"\x41\x8b\x40\x00\x41\x8b\x78\x00\x48\x85\xff\x74\x0b\x48\x31\xd2\x48\xf7\xf7\x48\x63\xc0\xeb\x06\x48\x0d\xff\xff\xff\xff\x49\x89\x40\x00\x49\x83\xc1\x04", 38, 3, 7, 33, -1, -1},
+	[3] = {(uint8_t*)"\x41\x8b\x40\x00\x41\x8b\x78\x00\x48\x85\xff\x74\x0b\x48\x31\xd2\x48\xf7\xf7\x48\x63\xc0\xeb\x06\x48\x0d\xff\xff\xff\xff\x49\x89\x40\x00\x49\x83\xc1\x04", 38, 3, 7, 33, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_REMW[] = {
+	[0] = {(uint8_t*)"\x49\x63\x70\x00\x49\x63\x78\x00\x48\x85\xff\x74\x2a\x48\x81\xff\xff\xff\xff\xff\x75\x11\xb8\x01\x00\x00\x00\x48\xc1\xe0\x1f\x48\x63\xc0\x48\x39\xc6\x74\x0d\x48\x89\xf0\x48\x99\x48\xf7\xff\x48\x63\xd2\xeb\x06\x48\x31\xf6\x48\x89\xf2\x49\x89\x50\x00\x49\x83\xc1\x04", 66, 3, 7, 61, -1, -1},
+	[1] = {(uint8_t*)"\x49\x63\x70\x00\x49\x63\x78\x00\x48\x85\xff\x74\x2a\x48\x81\xff\xff\xff\xff\xff\x75\x11\xb8\x01\x00\x00\x00\x48\xc1\xe0\x1f\x48\x63\xc0\x48\x39\xc6\x74\x0d\x48\x89\xf0\x48\x99\x48\xf7\xff\x48\x63\xd2\xeb\x06\x48\x31\xf6\x48\x89\xf2\x49\x89\x50\x00\x49\x83\xc1\x04", 66, 3, 7, 61, -1, -1},
+	[2] = {(uint8_t*)"\x49\x63\x70\x00\x49\x63\x78\x00\x48\x85\xff\x74\x2a\x48\x81\xff\xff\xff\xff\xff\x75\x11\xb8\x01\x00\x00\x00\x48\xc1\xe0\x1f\x48\x63\xc0\x48\x39\xc6\x74\x0d\x48\x89\xf0\x48\x99\x48\xf7\xff\x48\x63\xd2\xeb\x06\x48\x31\xf6\x48\x89\xf2\x49\x89\x50\x00\x49\x83\xc1\x04", 66, 3, 7, 61, -1, -1},
+	[3] = {(uint8_t*)"\x49\x63\x70\x00\x49\x63\x78\x00\x48\x85\xff\x74\x2a\x48\x81\xff\xff\xff\xff\xff\x75\x11\xb8\x01\x00\x00\x00\x48\xc1\xe0\x1f\x48\x63\xc0\x48\x39\xc6\x74\x0d\x48\x89\xf0\x48\x99\x48\xf7\xff\x48\x63\xd2\xeb\x06\x48\x31\xf6\x48\x89\xf2\x49\x89\x50\x00\x49\x83\xc1\x04", 66, 3, 7, 61, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_REMUW[] = {
+	[0] = {(uint8_t*)"\x41\x8b\x40\x00\x41\x8b\x78\x00\x48\x85\xff\x74\x0b\x48\x31\xd2\x48\xf7\xf7\x48\x63\xd2\xeb\x03\x48\x89\xc2\x49\x89\x50\x00\x49\x83\xc1\x04", 35, 3, 7, 30, -1, -1},
+	[1] = {(uint8_t*)"\x41\x8b\x40\x00\x41\x8b\x78\x00\x48\x85\xff\x74\x0b\x48\x31\xd2\x48\xf7\xf7\x48\x63\xd2\xeb\x03\x48\x89\xc2\x49\x89\x50\x00\x49\x83\xc1\x04", 35, 3, 7, 30, -1, -1},
+	[2] = {(uint8_t*)"\x41\x8b\x40\x00\x41\x8b\x78\x00\x48\x85\xff\x74\x0b\x48\x31\xd2\x48\xf7\xf7\x48\x63\xd2\xeb\x03\x48\x89\xc2\x49\x89\x50\x00\x49\x83\xc1\x04", 35, 3, 7, 30, -1, -1},
+	[3] = {(uint8_t*)"\x41\x8b\x40\x00\x41\x8b\x78\x00\x48\x85\xff\x74\x0b\x48\x31\xd2\x48\xf7\xf7\x48\x63\xd2\xeb\x03\x48\x89\xc2\x49\x89\x50\x00\x49\x83\xc1\x04", 35, 3, 7, 30, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_LR_W[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x70\x00\x41\xff\x53\x30\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 19, 3, -1, 14, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x70\x00\x41\xff\x53\x30\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 19, 3, -1, 14, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x70\x00\x41\xff\x53\x30\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 19, 3, -1, 14, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x70\x00\x41\xff\x53\x30\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 19, 3, -1, 14, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_SC_W[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x50\x00\x41\xff\x53\x10\x49\xc7\x40\x00\x00\x00\x00\x00\x49\x83\xc1\x04", 24, 3, 7, 15, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x50\x00\x41\xff\x53\x10\x49\xc7\x40\x00\x00\x00\x00\x00\x49\x83\xc1\x04", 24, 3, 7, 15, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x50\x00\x41\xff\x53\x10\x49\xc7\x40\x00\x00\x00\x00\x00\x49\x83\xc1\x04", 24, 3, 7, 15, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x50\x00\x41\xff\x53\x10\x49\xc7\x40\x00\x00\x00\x00\x00\x49\x83\xc1\x04", 24, 3, 7, 15, -1, -1},
+	[4] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x50\x00\x41\xff\x53\x10\x49\x83\xc1\x04", 16, 3, 7, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x50\x00\x41\xff\x53\x10\x49\x83\xc1\x04", 16, 3, 7, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x50\x00\x41\xff\x53\x10\x49\x83\xc1\x04", 16, 3, 7, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x50\x00\x41\xff\x53\x10\x49\x83\xc1\x04", 16, 3, 7, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_AMOSWAP_W[] = {
+	[0] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 33, 3, 20, 28, -1, -1},
+	[1] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 33, 3, 20, 28, -1, -1},
+	[2] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 33, 3, 20, 28, -1, -1},
+	[3] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 33, 3, 20, 28, -1, -1},
+	[4] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x41\xff\x53\x10\x49\x83\xc1\x04", 29, 3, 20, -1, -1, -1},
+	[5] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x41\xff\x53\x10\x49\x83\xc1\x04", 29, 3, 20, -1, -1, -1},
+	[6] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x41\xff\x53\x10\x49\x83\xc1\x04", 29, 3, 20, -1, -1, -1},
+	[7] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x41\xff\x53\x10\x49\x83\xc1\x04", 29, 3, 20, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_AMOADD_W[] = {
+	[0] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x01\xf2\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[1] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x01\xf2\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[2] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x01\xf2\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[3] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x01\xf2\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[4] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x01\xf2\x41\xff\x53\x10\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[5] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x01\xf2\x41\xff\x53\x10\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[6] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x01\xf2\x41\xff\x53\x10\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[7] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x01\xf2\x41\xff\x53\x10\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_AMOXOR_W[] = {
+	[0] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x31\xf2\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[1] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x31\xf2\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[2] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x31\xf2\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[3] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x31\xf2\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[4] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x31\xf2\x41\xff\x53\x10\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[5] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x31\xf2\x41\xff\x53\x10\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[6] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x31\xf2\x41\xff\x53\x10\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[7] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x31\xf2\x41\xff\x53\x10\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_AMOAND_W[] = {
+	[0] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x21\xf2\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[1] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x21\xf2\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[2] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x21\xf2\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[3] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x21\xf2\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[4] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x21\xf2\x41\xff\x53\x10\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[5] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x21\xf2\x41\xff\x53\x10\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[6] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x21\xf2\x41\xff\x53\x10\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[7] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x21\xf2\x41\xff\x53\x10\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_AMOOR_W[] = {
+	[0] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x09\xf2\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[1] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x09\xf2\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[2] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x09\xf2\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[3] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x09\xf2\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[4] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x09\xf2\x41\xff\x53\x10\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[5] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x09\xf2\x41\xff\x53\x10\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[6] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x09\xf2\x41\xff\x53\x10\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[7] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x09\xf2\x41\xff\x53\x10\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_AMOMIN_W[] = {
+	[0] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4c\xd6\x4c\x89\xfe\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[1] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4c\xd6\x4c\x89\xfe\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[2] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4c\xd6\x4c\x89\xfe\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[3] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4c\xd6\x4c\x89\xfe\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[4] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4c\xd6\x4c\x89\xfe\x41\xff\x53\x10\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[5] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4c\xd6\x4c\x89\xfe\x41\xff\x53\x10\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[6] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4c\xd6\x4c\x89\xfe\x41\xff\x53\x10\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[7] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4c\xd6\x4c\x89\xfe\x41\xff\x53\x10\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_AMOMAX_W[] = {
+	[0] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4f\xd6\x4c\x89\xfe\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[1] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4f\xd6\x4c\x89\xfe\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[2] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4f\xd6\x4c\x89\xfe\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[3] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4f\xd6\x4c\x89\xfe\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[4] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4f\xd6\x4c\x89\xfe\x41\xff\x53\x10\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[5] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4f\xd6\x4c\x89\xfe\x41\xff\x53\x10\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[6] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4f\xd6\x4c\x89\xfe\x41\xff\x53\x10\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[7] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4f\xd6\x4c\x89\xfe\x41\xff\x53\x10\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_AMOMINU_W[] = {
+	[0] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x42\xd6\x4c\x89\xfe\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[1] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x42\xd6\x4c\x89\xfe\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[2] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x42\xd6\x4c\x89\xfe\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[3] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x42\xd6\x4c\x89\xfe\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[4] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x42\xd6\x4c\x89\xfe\x41\xff\x53\x10\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[5] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x42\xd6\x4c\x89\xfe\x41\xff\x53\x10\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[6] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x42\xd6\x4c\x89\xfe\x41\xff\x53\x10\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[7] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x42\xd6\x4c\x89\xfe\x41\xff\x53\x10\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_AMOMAXU_W[] = {
+	[0] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x47\xd6\x4c\x89\xfe\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[1] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x47\xd6\x4c\x89\xfe\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[2] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x47\xd6\x4c\x89\xfe\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[3] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x47\xd6\x4c\x89\xfe\x41\xff\x53\x10\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[4] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x47\xd6\x4c\x89\xfe\x41\xff\x53\x10\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[5] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x47\xd6\x4c\x89\xfe\x41\xff\x53\x10\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[6] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x47\xd6\x4c\x89\xfe\x41\xff\x53\x10\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[7] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x30\x4c\x63\xf0\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x47\xd6\x4c\x89\xfe\x41\xff\x53\x10\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_LR_D[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x70\x00\x41\xff\x53\x38\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, -1, 11, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x70\x00\x41\xff\x53\x38\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, -1, 11, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x70\x00\x41\xff\x53\x38\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, -1, 11, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x70\x00\x41\xff\x53\x38\x49\x89\x40\x00\x49\x83\xc1\x04", 16, 3, -1, 11, -1, -1},
+	[4] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_SC_D[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x50\x00\x41\xff\x53\x18\x49\xc7\x40\x00\x00\x00\x00\x00\x49\x83\xc1\x04", 24, 3, 7, 15, -1, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x50\x00\x41\xff\x53\x18\x49\xc7\x40\x00\x00\x00\x00\x00\x49\x83\xc1\x04", 24, 3, 7, 15, -1, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x50\x00\x41\xff\x53\x18\x49\xc7\x40\x00\x00\x00\x00\x00\x49\x83\xc1\x04", 24, 3, 7, 15, -1, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x50\x00\x41\xff\x53\x18\x49\xc7\x40\x00\x00\x00\x00\x00\x49\x83\xc1\x04", 24, 3, 7, 15, -1, -1},
+	[4] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x50\x00\x41\xff\x53\x18\x49\x83\xc1\x04", 16, 3, 7, -1, -1, -1},
+	[5] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x50\x00\x41\xff\x53\x18\x49\x83\xc1\x04", 16, 3, 7, -1, -1, -1},
+	[6] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x50\x00\x41\xff\x53\x18\x49\x83\xc1\x04", 16, 3, 7, -1, -1, -1},
+	[7] = {(uint8_t*)"\x49\x8b\x70\x00\x49\x8b\x50\x00\x41\xff\x53\x18\x49\x83\xc1\x04", 16, 3, 7, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_AMOSWAP_D[] = {
+	[0] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 33, 3, 20, 28, -1, -1},
+	[1] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 33, 3, 20, 28, -1, -1},
+	[2] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 33, 3, 20, 28, -1, -1},
+	[3] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 33, 3, 20, 28, -1, -1},
+	[4] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x41\xff\x53\x18\x49\x83\xc1\x04", 29, 3, 20, -1, -1, -1},
+	[5] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x41\xff\x53\x18\x49\x83\xc1\x04", 29, 3, 20, -1, -1, -1},
+	[6] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x41\xff\x53\x18\x49\x83\xc1\x04", 29, 3, 20, -1, -1, -1},
+	[7] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x41\xff\x53\x18\x49\x83\xc1\x04", 29, 3, 20, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_AMOADD_D[] = {
+	[0] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x01\xf2\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[1] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x01\xf2\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[2] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x01\xf2\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[3] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x01\xf2\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[4] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x01\xf2\x41\xff\x53\x18\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[5] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x01\xf2\x41\xff\x53\x18\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[6] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x01\xf2\x41\xff\x53\x18\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[7] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x01\xf2\x41\xff\x53\x18\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_AMOXOR_D[] = {
+	[0] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x31\xf2\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[1] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x31\xf2\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[2] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x31\xf2\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[3] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x31\xf2\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[4] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x31\xf2\x41\xff\x53\x18\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[5] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x31\xf2\x41\xff\x53\x18\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[6] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x31\xf2\x41\xff\x53\x18\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[7] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x31\xf2\x41\xff\x53\x18\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_AMOAND_D[] = {
+	[0] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x21\xf2\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[1] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x21\xf2\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[2] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x21\xf2\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[3] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x21\xf2\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[4] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x21\xf2\x41\xff\x53\x18\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[5] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x21\xf2\x41\xff\x53\x18\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[6] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x21\xf2\x41\xff\x53\x18\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[7] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x21\xf2\x41\xff\x53\x18\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_AMOOR_D[] = {
+	[0] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x09\xf2\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[1] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x09\xf2\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[2] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x09\xf2\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[3] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x09\xf2\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 36, 3, 20, 31, -1, -1},
+	[4] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x09\xf2\x41\xff\x53\x18\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[5] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x09\xf2\x41\xff\x53\x18\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[6] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x09\xf2\x41\xff\x53\x18\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+	[7] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x4c\x89\xfe\x49\x8b\x50\x00\x4c\x09\xf2\x41\xff\x53\x18\x49\x83\xc1\x04", 32, 3, 20, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_AMOMIN_D[] = {
+	[0] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4c\xd6\x4c\x89\xfe\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[1] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4c\xd6\x4c\x89\xfe\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[2] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4c\xd6\x4c\x89\xfe\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[3] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4c\xd6\x4c\x89\xfe\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[4] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4c\xd6\x4c\x89\xfe\x41\xff\x53\x18\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[5] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4c\xd6\x4c\x89\xfe\x41\xff\x53\x18\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[6] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4c\xd6\x4c\x89\xfe\x41\xff\x53\x18\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[7] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4c\xd6\x4c\x89\xfe\x41\xff\x53\x18\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_AMOMAX_D[] = {
+	[0] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4f\xd6\x4c\x89\xfe\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[1] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4f\xd6\x4c\x89\xfe\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[2] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4f\xd6\x4c\x89\xfe\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[3] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4f\xd6\x4c\x89\xfe\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[4] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4f\xd6\x4c\x89\xfe\x41\xff\x53\x18\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[5] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4f\xd6\x4c\x89\xfe\x41\xff\x53\x18\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[6] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4f\xd6\x4c\x89\xfe\x41\xff\x53\x18\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[7] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x4f\xd6\x4c\x89\xfe\x41\xff\x53\x18\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_AMOMINU_D[] = {
+	[0] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x42\xd6\x4c\x89\xfe\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[1] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x42\xd6\x4c\x89\xfe\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[2] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x42\xd6\x4c\x89\xfe\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[3] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x42\xd6\x4c\x89\xfe\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[4] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x42\xd6\x4c\x89\xfe\x41\xff\x53\x18\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[5] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x42\xd6\x4c\x89\xfe\x41\xff\x53\x18\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[6] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x42\xd6\x4c\x89\xfe\x41\xff\x53\x18\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[7] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x42\xd6\x4c\x89\xfe\x41\xff\x53\x18\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_AMOMAXU_D[] = {
+	[0] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x47\xd6\x4c\x89\xfe\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[1] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x47\xd6\x4c\x89\xfe\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[2] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x47\xd6\x4c\x89\xfe\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[3] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x47\xd6\x4c\x89\xfe\x41\xff\x53\x18\x4d\x89\x70\x00\x49\x83\xc1\x04", 40, 3, 17, 35, -1, -1},
+	[4] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x47\xd6\x4c\x89\xfe\x41\xff\x53\x18\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[5] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x47\xd6\x4c\x89\xfe\x41\xff\x53\x18\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[6] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x47\xd6\x4c\x89\xfe\x41\xff\x53\x18\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+	[7] = {(uint8_t*)"\x4d\x8b\x78\x00\x4c\x89\xfe\x41\xff\x53\x38\x49\x89\xc6\x49\x8b\x50\x00\x49\x39\xd6\x49\x0f\x47\xd6\x4c\x89\xfe\x41\xff\x53\x18\x49\x83\xc1\x04", 36, 3, 17, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_LB[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x00\xf0\xff\xff\x48\x3b\x48\x00\x75\x0a\x48\x03\x70\x10\x48\x0f\xbe\x06\xeb\x0b\x48\x89\xc2\x41\xff\x53\xb8\x48\x0f\xbe\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 68, 3, -1, 63, 7, 12},
+	[1] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x00\xf0\xff\xff\x48\x3b\x48\x00\x75\x0a\x48\x03\x70\x10\x48\x0f\xbe\x06\xeb\x0b\x48\x89\xc2\x41\xff\x53\xb8\x48\x0f\xbe\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 68, 3, -1, 63, 7, 12},
+	[2] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_LH[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x01\xf0\xff\xff\x48\x3b\x48\x00\x75\x0a\x48\x03\x70\x10\x48\x0f\xbf\x06\xeb\x0b\x48\x89\xc2\x41\xff\x53\xb0\x48\x0f\xbf\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 68, 3, -1, 63, 7, 12},
+	[1] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x01\xf0\xff\xff\x48\x3b\x48\x00\x75\x0a\x48\x03\x70\x10\x48\x0f\xbf\x06\xeb\x0b\x48\x89\xc2\x41\xff\x53\xb0\x48\x0f\xbf\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 68, 3, -1, 63, 7, 12},
+	[2] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_LW[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x03\xf0\xff\xff\x48\x3b\x48\x00\x75\x09\x48\x03\x70\x10\x48\x63\x06\xeb\x0a\x48\x89\xc2\x41\xff\x53\xa8\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 66, 3, -1, 61, 7, 12},
+	[1] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x03\xf0\xff\xff\x48\x3b\x48\x00\x75\x09\x48\x03\x70\x10\x48\x63\x06\xeb\x0a\x48\x89\xc2\x41\xff\x53\xa8\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 66, 3, -1, 61, 7, 12},
+	[2] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_LD[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x07\xf0\xff\xff\x48\x3b\x48\x00\x75\x09\x48\x03\x70\x10\x48\x8b\x06\xeb\x07\x48\x89\xc2\x41\xff\x53\xa0\x49\x89\x40\x00\x49\x83\xc1\x04", 63, 3, -1, 58, 7, 12},
+	[1] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x07\xf0\xff\xff\x48\x3b\x48\x00\x75\x09\x48\x03\x70\x10\x48\x8b\x06\xeb\x07\x48\x89\xc2\x41\xff\x53\xa0\x49\x89\x40\x00\x49\x83\xc1\x04", 63, 3, -1, 58, 7, 12},
+	[2] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_LBU[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x00\xf0\xff\xff\x48\x3b\x48\x00\x75\x0a\x48\x03\x70\x10\x48\x0f\xb6\x06\xeb\x0d\x48\x89\xc2\x41\xff\x53\xb8\x48\x25\xff\x00\x00\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 70, 3, -1, 65, 7, 12},
+	[1] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x00\xf0\xff\xff\x48\x3b\x48\x00\x75\x0a\x48\x03\x70\x10\x48\x0f\xb6\x06\xeb\x0d\x48\x89\xc2\x41\xff\x53\xb8\x48\x25\xff\x00\x00\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 70, 3, -1, 65, 7, 12},
+	[2] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_LHU[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x01\xf0\xff\xff\x48\x3b\x48\x00\x75\x0a\x48\x03\x70\x10\x48\x0f\xb7\x06\xeb\x0d\x48\x89\xc2\x41\xff\x53\xb0\x48\x25\xff\xff\x00\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 70, 3, -1, 65, 7, 12},
+	[1] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x01\xf0\xff\xff\x48\x3b\x48\x00\x75\x0a\x48\x03\x70\x10\x48\x0f\xb7\x06\xeb\x0d\x48\x89\xc2\x41\xff\x53\xb0\x48\x25\xff\xff\x00\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 70, 3, -1, 65, 7, 12},
+	[2] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_LWU[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x03\xf0\xff\xff\x48\x3b\x48\x00\x75\x08\x48\x03\x70\x10\x8b\x06\xeb\x09\x48\x89\xc2\x41\xff\x53\xa8\x8b\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 64, 3, -1, 59, 7, 12},
+	[1] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x03\xf0\xff\xff\x48\x3b\x48\x00\x75\x08\x48\x03\x70\x10\x8b\x06\xeb\x09\x48\x89\xc2\x41\xff\x53\xa8\x8b\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 64, 3, -1, 59, 7, 12},
+	[2] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_FENCE[] = {
+	[0] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[1] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[2] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_FENCEI[] = {
+	[0] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[1] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[2] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_ADDI[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x05\x00\x00\x00\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 18, 3, -1, 13, 6, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x05\x00\x00\x00\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 18, 3, -1, 13, 6, -1},
+	[2] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_SLLI[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\xb9\x00\x00\x00\x00\x48\x81\xe1\x3f\x00\x00\x00\x48\xd3\xe0\x49\x89\x40\x00\x49\x83\xc1\x04", 27, 3, -1, 22, 5, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\xb9\x00\x00\x00\x00\x48\x81\xe1\x3f\x00\x00\x00\x48\xd3\xe0\x49\x89\x40\x00\x49\x83\xc1\x04", 27, 3, -1, 22, 5, -1},
+	[2] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_SLTI[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x31\xc9\x48\x3d\x00\x00\x00\x00\x0f\x9c\xc1\x49\x89\x48\x00\x49\x83\xc1\x04", 24, 3, -1, 19, 9, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x31\xc9\x48\x3d\x00\x00\x00\x00\x0f\x9c\xc1\x49\x89\x48\x00\x49\x83\xc1\x04", 24, 3, -1, 19, 9, -1},
+	[2] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_SLTIU[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x31\xc9\x48\x3d\x00\x00\x00\x00\x0f\x92\xc1\x49\x89\x48\x00\x49\x83\xc1\x04", 24, 3, -1, 19, 9, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x31\xc9\x48\x3d\x00\x00\x00\x00\x0f\x92\xc1\x49\x89\x48\x00\x49\x83\xc1\x04", 24, 3, -1, 19, 9, -1},
+	[2] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_XORI[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x35\x00\x00\x00\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 18, 3, -1, 13, 6, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x35\x00\x00\x00\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 18, 3, -1, 13, 6, -1},
+	[2] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_SRLI[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\xb9\x00\x00\x00\x00\x48\xf7\xc1\x00\x04\x00\x00\x74\x0c\x48\x81\xe1\x3f\x00\x00\x00\x48\xd3\xf8\xeb\x0a\x48\x81\xe1\x3f\x00\x00\x00\x48\xd3\xe8\x49\x89\x40\x00\x49\x83\xc1\x04", 48, 3, -1, 43, 5, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\xb9\x00\x00\x00\x00\x48\xf7\xc1\x00\x04\x00\x00\x74\x0c\x48\x81\xe1\x3f\x00\x00\x00\x48\xd3\xf8\xeb\x0a\x48\x81\xe1\x3f\x00\x00\x00\x48\xd3\xe8\x49\x89\x40\x00\x49\x83\xc1\x04", 48, 3, -1, 43, 5, -1},
+	[2] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_ORI[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x0d\x00\x00\x00\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 18, 3, -1, 13, 6, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x0d\x00\x00\x00\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 18, 3, -1, 13, 6, -1},
+	[2] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_ANDI[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x25\x00\x00\x00\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 18, 3, -1, 13, 6, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x25\x00\x00\x00\x00\x49\x89\x40\x00\x49\x83\xc1\x04", 18, 3, -1, 13, 6, -1},
+	[2] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_ADDIW[] = {
+	[0] = {(uint8_t*)"\x41\x8b\x40\x00\x48\x05\x00\x00\x00\x00\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 21, 3, -1, 16, 6, -1},
+	[1] = {(uint8_t*)"\x41\x8b\x40\x00\x48\x05\x00\x00\x00\x00\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 21, 3, -1, 16, 6, -1},
+	[2] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_SLLIW[] = {
+	[0] = {(uint8_t*)"\x41\x8b\x40\x00\xb9\x00\x00\x00\x00\x48\x81\xe1\x1f\x00\x00\x00\x48\xd3\xe0\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 30, 3, -1, 25, 5, -1},
+	[1] = {(uint8_t*)"\x41\x8b\x40\x00\xb9\x00\x00\x00\x00\x48\x81\xe1\x1f\x00\x00\x00\x48\xd3\xe0\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 30, 3, -1, 25, 5, -1},
+	[2] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_SRLIW[] = {
+	[0] = {(uint8_t*)"\x41\x8b\x40\x00\xb9\x00\x00\x00\x00\x48\xf7\xc1\x00\x04\x00\x00\x74\x0f\x48\x63\xc0\x48\x81\xe1\x1f\x00\x00\x00\x48\xd3\xf8\xeb\x0d\x48\x81\xe1\x1f\x00\x00\x00\x48\xd3\xe8\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 54, 3, -1, 49, 5, -1},
+	[1] = {(uint8_t*)"\x41\x8b\x40\x00\xb9\x00\x00\x00\x00\x48\xf7\xc1\x00\x04\x00\x00\x74\x0f\x48\x63\xc0\x48\x81\xe1\x1f\x00\x00\x00\x48\xd3\xf8\xeb\x0d\x48\x81\xe1\x1f\x00\x00\x00\x48\xd3\xe8\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 54, 3, -1, 49, 5, -1},
+	[2] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_JALR[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x05\x00\x00\x00\x00\x48\x25\xfe\xff\xff\xff\x4c\x89\xc9\x48\x83\xc1\x04\x49\x89\x48\x00\x4d\x89\xcd\x49\x89\xc1\x41\xff\xe2", 36, 3, -1, 26, 6, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x05\x00\x00\x00\x00\x48\x25\xfe\xff\xff\xff\x4c\x89\xc9\x48\x83\xc1\x04\x49\x89\x48\x00\x4d\x89\xcd\x49\x89\xc1\x41\xff\xe2", 36, 3, -1, 26, 6, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x05\x00\x00\x00\x00\x48\x25\xfe\xff\xff\xff\x4d\x89\xcd\x49\x89\xc1\x41\xff\xe2", 25, 3, -1, -1, 6, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x48\x05\x00\x00\x00\x00\x48\x25\xfe\xff\xff\xff\x4d\x89\xcd\x49\x89\xc1\x41\xff\xe2", 25, 3, -1, -1, 6, -1},
+};
+const dr_x86_code_t DR_X86_SYSTEM[] = {
+	{(uint8_t*)"\x41\xff\x53\x48\x49\x83\xc1\x04", 8, -1, -1, -1, -1, -1},
+	{(uint8_t*)"\x41\xff\x53\x40\x49\x83\xc1\x04", 8, -1, -1, -1, -1, -1},
+	{(uint8_t*)"\x41\xff\x53\x78\x49\x83\xc1\x04", 8, -1, -1, -1, -1, -1},
+	{(uint8_t*)"\x41\xff\x53\xf0\x49\x83\xc1\x04", 8, -1, -1, -1, -1, -1},
+	{(uint8_t*)"\x41\xff\x53\xf8\x49\x83\xc1\x04", 8, -1, -1, -1, -1, -1},
+	{(uint8_t*)"\x41\xff\x53\xe8\x49\x83\xc1\x04", 8, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_CSRRW[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x50\x00\xbe\x00\x00\x00\x00\x48\x81\xe6\xff\x0f\x00\x00\x41\xff\x53\x60\x49\x89\x40\x00\x49\x83\xc1\x04", 28, 3, -1, 23, 5, -1},
+	[1] = {(uint8_t*)"\x48\x31\xd2\xbe\x00\x00\x00\x00\x48\x81\xe6\xff\x0f\x00\x00\x41\xff\x53\x60\x49\x89\x40\x00\x49\x83\xc1\x04", 27, -1, -1, 22, 4, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x50\x00\xbe\x00\x00\x00\x00\x48\x81\xe6\xff\x0f\x00\x00\x41\xff\x53\x58\x49\x83\xc1\x04", 24, 3, -1, -1, 5, -1},
+	[3] = {(uint8_t*)"\x48\x31\xd2\xbe\x00\x00\x00\x00\x48\x81\xe6\xff\x0f\x00\x00\x41\xff\x53\x58\x49\x83\xc1\x04", 23, -1, -1, -1, 4, -1},
+};
+const dr_x86_code_t DR_X86_CSRRS[] = {
+	[0] = {(uint8_t*)"\xbe\x00\x00\x00\x00\x48\x81\xe6\xff\x0f\x00\x00\x49\x8b\x50\x00\x41\xff\x53\x68\x49\x89\x40\x00\x49\x83\xc1\x04", 28, 15, -1, 23, 1, -1},
+	[1] = {(uint8_t*)"\xbe\x00\x00\x00\x00\x48\x81\xe6\xff\x0f\x00\x00\x41\xff\x53\x50\x49\x89\x40\x00\x49\x83\xc1\x04", 24, -1, -1, 19, 1, -1},
+	[2] = {(uint8_t*)"\xbe\x00\x00\x00\x00\x48\x81\xe6\xff\x0f\x00\x00\x49\x8b\x50\x00\x41\xff\x53\x68\x49\x83\xc1\x04", 24, 15, -1, -1, 1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_CSRRC[] = {
+	[0] = {(uint8_t*)"\xbe\x00\x00\x00\x00\x48\x81\xe6\xff\x0f\x00\x00\x49\x8b\x50\x00\x41\xff\x53\x70\x49\x89\x40\x00\x49\x83\xc1\x04", 28, 15, -1, 23, 1, -1},
+	[1] = {(uint8_t*)"\xbe\x00\x00\x00\x00\x48\x81\xe6\xff\x0f\x00\x00\x41\xff\x53\x50\x49\x89\x40\x00\x49\x83\xc1\x04", 24, -1, -1, 19, 1, -1},
+	[2] = {(uint8_t*)"\xbe\x00\x00\x00\x00\x48\x81\xe6\xff\x0f\x00\x00\x49\x8b\x50\x00\x41\xff\x53\x70\x49\x83\xc1\x04", 24, 15, -1, -1, 1, -1},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_CSRRWI[] = {
+	[0] = {(uint8_t*)"\xba\x00\x00\x00\x00\xbe\x00\x00\x00\x00\x48\x81\xe6\xff\x0f\x00\x00\x41\xff\x53\x60\x49\x89\x40\x00\x49\x83\xc1\x04", 29, -1, -1, 24, 6, 1},
+	[1] = {(uint8_t*)"\x48\x31\xd2\xbe\x00\x00\x00\x00\x48\x81\xe6\xff\x0f\x00\x00\x41\xff\x53\x60\x49\x89\x40\x00\x49\x83\xc1\x04", 27, -1, -1, 22, 4, -1},
+	[2] = {(uint8_t*)"\xba\x00\x00\x00\x00\xbe\x00\x00\x00\x00\x48\x81\xe6\xff\x0f\x00\x00\x41\xff\x53\x58\x49\x83\xc1\x04", 25, -1, -1, -1, 6, 1},
+	[3] = {(uint8_t*)"\x48\x31\xd2\xbe\x00\x00\x00\x00\x48\x81\xe6\xff\x0f\x00\x00\x41\xff\x53\x58\x49\x83\xc1\x04", 23, -1, -1, -1, 4, -1},
+};
+const dr_x86_code_t DR_X86_CSRRSI[] = {
+	[0] = {(uint8_t*)"\xbe\x00\x00\x00\x00\x48\x81\xe6\xff\x0f\x00\x00\xba\x00\x00\x00\x00\x41\xff\x53\x68\x49\x89\x40\x00\x49\x83\xc1\x04", 29, -1, -1, 24, 1, 13},
+	[1] = {(uint8_t*)"\xbe\x00\x00\x00\x00\x48\x81\xe6\xff\x0f\x00\x00\x41\xff\x53\x50\x49\x89\x40\x00\x49\x83\xc1\x04", 24, -1, -1, 19, 1, -1},
+	[2] = {(uint8_t*)"\xbe\x00\x00\x00\x00\x48\x81\xe6\xff\x0f\x00\x00\xba\x00\x00\x00\x00\x41\xff\x53\x68\x49\x83\xc1\x04", 25, -1, -1, -1, 1, 13},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_CSRRCI[] = {
+	[0] = {(uint8_t*)"\xbe\x00\x00\x00\x00\x48\x81\xe6\xff\x0f\x00\x00\xba\x00\x00\x00\x00\x41\xff\x53\x70\x49\x89\x40\x00\x49\x83\xc1\x04", 29, -1, -1, 24, 1, 13},
+	[1] = {(uint8_t*)"\xbe\x00\x00\x00\x00\x48\x81\xe6\xff\x0f\x00\x00\x41\xff\x53\x50\x49\x89\x40\x00\x49\x83\xc1\x04", 24, -1, -1, 19, 1, -1},
+	[2] = {(uint8_t*)"\xbe\x00\x00\x00\x00\x48\x81\xe6\xff\x0f\x00\x00\xba\x00\x00\x00\x00\x41\xff\x53\x70\x49\x83\xc1\x04", 25, -1, -1, -1, 1, 13},
+	[3] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_SB[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\x49\x8b\x50\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x00\xf0\xff\xff\x48\x3b\x48\x08\x75\x08\x48\x03\x70\x10\x88\x16\xeb\x07\x48\x89\xc1\x41\xff\x53\xd8\x49\x83\xc1\x04", 62, 3, 14, -1, 7, 16},
+	[1] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\x49\x8b\x50\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x00\xf0\xff\xff\x48\x3b\x48\x08\x75\x08\x48\x03\x70\x10\x88\x16\xeb\x07\x48\x89\xc1\x41\xff\x53\xd8\x49\x83\xc1\x04", 62, 3, 14, -1, 7, 16},
+	[2] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\x49\x8b\x50\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x00\xf0\xff\xff\x48\x3b\x48\x08\x75\x08\x48\x03\x70\x10\x88\x16\xeb\x07\x48\x89\xc1\x41\xff\x53\xd8\x49\x83\xc1\x04", 62, 3, 14, -1, 7, 16},
+	[3] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\x49\x8b\x50\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x00\xf0\xff\xff\x48\x3b\x48\x08\x75\x08\x48\x03\x70\x10\x88\x16\xeb\x07\x48\x89\xc1\x41\xff\x53\xd8\x49\x83\xc1\x04", 62, 3, 14, -1, 7, 16},
+};
+const dr_x86_code_t DR_X86_SH[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\x49\x8b\x50\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x01\xf0\xff\xff\x48\x3b\x48\x08\x75\x09\x48\x03\x70\x10\x66\x89\x16\xeb\x07\x48\x89\xc1\x41\xff\x53\xd0\x49\x83\xc1\x04", 63, 3, 14, -1, 7, 16},
+	[1] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\x49\x8b\x50\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x01\xf0\xff\xff\x48\x3b\x48\x08\x75\x09\x48\x03\x70\x10\x66\x89\x16\xeb\x07\x48\x89\xc1\x41\xff\x53\xd0\x49\x83\xc1\x04", 63, 3, 14, -1, 7, 16},
+	[2] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\x49\x8b\x50\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x01\xf0\xff\xff\x48\x3b\x48\x08\x75\x09\x48\x03\x70\x10\x66\x89\x16\xeb\x07\x48\x89\xc1\x41\xff\x53\xd0\x49\x83\xc1\x04", 63, 3, 14, -1, 7, 16},
+	[3] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\x49\x8b\x50\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x01\xf0\xff\xff\x48\x3b\x48\x08\x75\x09\x48\x03\x70\x10\x66\x89\x16\xeb\x07\x48\x89\xc1\x41\xff\x53\xd0\x49\x83\xc1\x04", 63, 3, 14, -1, 7, 16},
+};
+const dr_x86_code_t DR_X86_SW[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\x49\x8b\x50\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x03\xf0\xff\xff\x48\x3b\x48\x08\x75\x08\x48\x03\x70\x10\x89\x16\xeb\x07\x48\x89\xc1\x41\xff\x53\xc8\x49\x83\xc1\x04", 62, 3, 14, -1, 7, 16},
+	[1] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\x49\x8b\x50\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x03\xf0\xff\xff\x48\x3b\x48\x08\x75\x08\x48\x03\x70\x10\x89\x16\xeb\x07\x48\x89\xc1\x41\xff\x53\xc8\x49\x83\xc1\x04", 62, 3, 14, -1, 7, 16},
+	[2] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\x49\x8b\x50\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x03\xf0\xff\xff\x48\x3b\x48\x08\x75\x08\x48\x03\x70\x10\x89\x16\xeb\x07\x48\x89\xc1\x41\xff\x53\xc8\x49\x83\xc1\x04", 62, 3, 14, -1, 7, 16},
+	[3] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\x49\x8b\x50\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x03\xf0\xff\xff\x48\x3b\x48\x08\x75\x08\x48\x03\x70\x10\x89\x16\xeb\x07\x48\x89\xc1\x41\xff\x53\xc8\x49\x83\xc1\x04", 62, 3, 14, -1, 7, 16},
+};
+const dr_x86_code_t DR_X86_SD[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\x49\x8b\x50\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x07\xf0\xff\xff\x48\x3b\x48\x08\x75\x09\x48\x03\x70\x10\x48\x89\x16\xeb\x07\x48\x89\xc1\x41\xff\x53\xc0\x49\x83\xc1\x04", 63, 3, 14, -1, 7, 16},
+	[1] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\x49\x8b\x50\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x07\xf0\xff\xff\x48\x3b\x48\x08\x75\x09\x48\x03\x70\x10\x48\x89\x16\xeb\x07\x48\x89\xc1\x41\xff\x53\xc0\x49\x83\xc1\x04", 63, 3, 14, -1, 7, 16},
+	[2] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\x49\x8b\x50\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x07\xf0\xff\xff\x48\x3b\x48\x08\x75\x09\x48\x03\x70\x10\x48\x89\x16\xeb\x07\x48\x89\xc1\x41\xff\x53\xc0\x49\x83\xc1\x04", 63, 3, 14, -1, 7, 16},
+	[3] = {(uint8_t*)"\x49\x8b\x70\x00\x48\x81\xc6\x00\x00\x00\x00\x49\x8b\x50\x00\xb8\x00\x00\x00\x00\x48\xc1\xe0\x05\x48\x01\xd8\x48\x89\xf1\x48\x81\xe1\x07\xf0\xff\xff\x48\x3b\x48\x08\x75\x09\x48\x03\x70\x10\x48\x89\x16\xeb\x07\x48\x89\xc1\x41\xff\x53\xc0\x49\x83\xc1\x04", 63, 3, 14, -1, 7, 16},
+};
+const dr_x86_code_t DR_X86_BEQ[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x75\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x75\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x75\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x75\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+};
+const dr_x86_code_t DR_X86_BNE[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x74\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x74\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x74\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x74\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+};
+const dr_x86_code_t DR_X86_BLT[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x7d\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x7d\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x7d\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x7d\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+};
+const dr_x86_code_t DR_X86_BGE[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x7c\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x7c\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x7c\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x7c\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+};
+const dr_x86_code_t DR_X86_BLTU[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x73\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x73\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x73\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x73\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+};
+const dr_x86_code_t DR_X86_BGEU[] = {
+	[0] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x72\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+	[1] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x72\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+	[2] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x72\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+	[3] = {(uint8_t*)"\x49\x8b\x40\x00\x49\x3b\x40\x00\x72\x0d\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2\x49\x83\xc1\x04", 27, 3, 7, -1, 16, -1},
+};
+const dr_x86_code_t DR_X86_AUIPC[] = {
+	[0] = {(uint8_t*)"\xb8\x00\x00\x00\x00\x48\x63\xc0\x4c\x01\xc8\x49\x89\x40\x00\x49\x83\xc1\x04", 19, -1, -1, 14, 1, -1},
+	[1] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_LUI[] = {
+	[0] = {(uint8_t*)"\xb8\x00\x00\x00\x00\x48\x63\xc0\x49\x89\x40\x00\x49\x83\xc1\x04", 16, -1, -1, 11, 1, -1},
+	[1] = {(uint8_t*)"\x49\x83\xc1\x04", 4, -1, -1, -1, -1, -1},
+};
+const dr_x86_code_t DR_X86_JAL[] = {
+	[0] = {(uint8_t*)"\x4c\x89\xc8\x48\x83\xc0\x04\x49\x89\x40\x00\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2", 24, -1, -1, 10, 17, -1},
+	[1] = {(uint8_t*)"\x4d\x89\xcd\x49\x81\xc1\x00\x00\x00\x00\x41\xff\xe2", 13, -1, -1, -1, 6, -1},
+};
@@ -102,3 +102,14 @@ void codegen_end_line(void) {
 
 	codegen_current_ins++;
 }
+
+size_t codegen_pos(void) {
+	return codegen_current_line.pos;
+}
+
+void codegen_fix_jump(size_t jump_end) {
+	assert(jump_end > 0 && jump_end <= codegen_current_line.pos);
+	size_t disp = codegen_current_line.pos - jump_end;
+	assert(disp <= INT8_MAX);
+	codegen_current_line.buffer[jump_end - 1] = disp;
+}
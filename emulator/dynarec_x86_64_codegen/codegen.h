@@ -51,6 +51,17 @@ void codegen_asm(x86_mnemonic_t mnemonic, x86_operand_t dst, x86_operand_t src,
  */
 void codegen_end_line(void);
 
+/* codegen_pos : get the current position in the entry being emitted, it is used as a label
+ *               for forward jumps
+ */
+size_t codegen_pos(void);
+
+/* codegen_fix_jump : patch the 8-bit displacement of a short jump to make it point to the
+ *                    current position
+ *     size_t jump_end : position right after the jump instruction to patch
+ */
+void codegen_fix_jump(size_t jump_end);
+
 /* C_X : macros used to declare the emitting function of a X-type instruction
  */
 #define C_R(MNEMONIC)         static inline void codegen_##MNEMONIC(bool rs1_zero, bool rs2_zero, bool rd_zero)
@@ -94,6 +105,49 @@ void codegen_end_line(void);
 		A(CALL, OP_DISP(R11, index * 8), 0); \
 	} while (0)
 
+/* PAGE_CACHE_X : layout of a dr_page_cache_entry_t as seen by the emitted code
+ *                see emulator/dynarec_x86_64.h
+ */
+#define PAGE_CACHE_ENTRY_SHIFT 5
+#define PAGE_CACHE_READ_TAG    0
+#define PAGE_CACHE_WRITE_TAG   8
+#define PAGE_CACHE_HOST_OFFSET 16
+
+/* PAGE_CACHE_LOOKUP : macro used to look up the page cache entry of the base register rs1
+ *                     for an access of SIZE bytes at the guest virtual address in RSI
+ *                     on a hit, RSI is translated to the host address, on a miss we jump
+ *                     to `MISS_LABEL` with RAX pointing to the entry
+ *                     we clobber RAX and RCX
+ */
+#define PAGE_CACHE_LOOKUP(SIZE, TAG, MISS_LABEL)                                        \
+	do {                                                                            \
+		A_RS1UIMM(MOV, OP_REG(RAX), OP_RELOC_IMM32);                            \
+		A(SHL, OP_REG(RAX), OP_IMM(PAGE_CACHE_ENTRY_SHIFT));                    \
+		A(ADD, OP_REG(RAX), OP_REG(RBX));                                       \
+		A(MOV, OP_REG(RCX), OP_REG(RSI));                                       \
+		/* Misaligned accesses keep some low bits set and always miss */       \
+		A(AND, OP_REG(RCX), OP_IMM(~0xfff | ((SIZE)-1)));                       \
+		A(CMP, OP_REG(RCX), OP_DISP(RAX, TAG));                                 \
+		J_FWD(JNZ, MISS_LABEL);                                                 \
+		A(ADD, OP_REG(RSI), OP_DISP(RAX, PAGE_CACHE_HOST_OFFSET));              \
+	} while (0)
+
+/* J_FWD : macro used to emit a short jump to a label not emitted yet, the position
+ *         right after the jump is stored to `LABEL` to be fixed by `L_FWD`
+ */
+#define J_FWD(MNEMONIC, LABEL)                   \
+	do {                                     \
+		A(MNEMONIC, OP_IMM(0), 0);       \
+		LABEL = codegen_pos();           \
+	} while (0)
+
+/* L_FWD : macro used to place a label used by a previous `J_FWD`
+ */
+#define L_FWD(LABEL)                     \
+	do {                             \
+		codegen_fix_jump(LABEL); \
+	} while (0)
+
 /* E : macro used to end the line of an instruction and increment PC
  */
 #define E()                                    \
@@ -10,8 +10,9 @@ C_B(BEQ) {
 
 	A_RS1(MOV, OP_REG(RAX), OP_RELOC_RV_REG);
 	A_RS2(CMP, OP_REG(RAX), OP_RELOC_RV_REG);
-	A(JNZ, OP_IMM(10), 0);
+	A(JNZ, OP_IMM(13), 0);
 
+	A(MOV, OP_REG(R13), OP_REG(R9));
 	A_IMM(ADD, OP_REG(R9), OP_RELOC_IMM32);
 	A(JMP, OP_REG(R10), 0);
 
@@ -23,8 +24,9 @@ C_B(BNE) {
 
 	A_RS1(MOV, OP_REG(RAX), OP_RELOC_RV_REG);
 	A_RS2(CMP, OP_REG(RAX), OP_RELOC_RV_REG);
-	A(JZ, OP_IMM(10), 0);
+	A(JZ, OP_IMM(13), 0);
 
+	A(MOV, OP_REG(R13), OP_REG(R9));
 	A_IMM(ADD, OP_REG(R9), OP_RELOC_IMM32);
 	A(JMP, OP_REG(R10), 0);
 
@@ -36,8 +38,9 @@ C_B(BLT) {
 
 	A_RS1(MOV, OP_REG(RAX), OP_RELOC_RV_REG);
 	A_RS2(CMP, OP_REG(RAX), OP_RELOC_RV_REG);
-	A(JGE, OP_IMM(10), 0);
+	A(JGE, OP_IMM(13), 0);
 
+	A(MOV, OP_REG(R13), OP_REG(R9));
 	A_IMM(ADD, OP_REG(R9), OP_RELOC_IMM32);
 	A(JMP, OP_REG(R10), 0);
 
@@ -49,8 +52,9 @@ C_B(BGE) {
 
 	A_RS1(MOV, OP_REG(RAX), OP_RELOC_RV_REG);
 	A_RS2(CMP, OP_REG(RAX), OP_RELOC_RV_REG);
-	A(JL, OP_IMM(10), 0);
+	A(JL, OP_IMM(13), 0);
 
+	A(MOV, OP_REG(R13), OP_REG(R9));
 	A_IMM(ADD, OP_REG(R9), OP_RELOC_IMM32);
 	A(JMP, OP_REG(R10), 0);
 
@@ -62,8 +66,9 @@ C_B(BLTU) {
 
 	A_RS1(MOV, OP_REG(RAX), OP_RELOC_RV_REG);
 	A_RS2(CMP, OP_REG(RAX), OP_RELOC_RV_REG);
-	A(JNC, OP_IMM(10), 0);
+	A(JNC, OP_IMM(13), 0);
 
+	A(MOV, OP_REG(R13), OP_REG(R9));
 	A_IMM(ADD, OP_REG(R9), OP_RELOC_IMM32);
 	A(JMP, OP_REG(R10), 0);
 
@@ -75,8 +80,9 @@ C_B(BGEU) {
 
 	A_RS1(MOV, OP_REG(RAX), OP_RELOC_RV_REG);
 	A_RS2(CMP, OP_REG(RAX), OP_RELOC_RV_REG);
-	A(JC, OP_IMM(10), 0);
+	A(JC, OP_IMM(13), 0);
 
+	A(MOV, OP_REG(R13), OP_REG(R9));
 	A_IMM(ADD, OP_REG(R9), OP_RELOC_IMM32);
 	A(JMP, OP_REG(R10), 0);
 
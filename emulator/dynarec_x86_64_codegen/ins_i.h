@@ -12,10 +12,19 @@ C_I(LB) {
 		E();
 	}
 
+	size_t miss, done;
 	A_RS1(MOV, OP_REG(RSI), OP_RELOC_RV_REG);
 	A_IMM(ADD, OP_REG(RSI), OP_RELOC_IMM32);
-	EMU_FUNCTION(4);
+	PAGE_CACHE_LOOKUP(1, PAGE_CACHE_READ_TAG, miss);
+	A(MOVSX8, OP_REG(RAX), OP_DEREF(RSI));
+	J_FWD(JMP, done);
+
+	L_FWD(miss);
+	A(MOV, OP_REG(RDX), OP_REG(RAX));
+	EMU_FUNCTION(-9);
 	A(MOVSX8, OP_REG(RAX), OP_REG(RAX));
+
+	L_FWD(done);
 	A_RD(MOV, OP_RELOC_RV_REG, OP_REG(RAX));
 
 	E();
@@ -28,10 +37,19 @@ C_I(LH) {
 		E();
 	}
 
+	size_t miss, done;
 	A_RS1(MOV, OP_REG(RSI), OP_RELOC_RV_REG);
 	A_IMM(ADD, OP_REG(RSI), OP_RELOC_IMM32);
-	EMU_FUNCTION(5);
+	PAGE_CACHE_LOOKUP(2, PAGE_CACHE_READ_TAG, miss);
+	A(MOVSX16, OP_REG(RAX), OP_DEREF(RSI));
+	J_FWD(JMP, done);
+
+	L_FWD(miss);
+	A(MOV, OP_REG(RDX), OP_REG(RAX));
+	EMU_FUNCTION(-10);
 	A(MOVSX16, OP_REG(RAX), OP_REG(RAX));
+
+	L_FWD(done);
 	A_RD(MOV, OP_RELOC_RV_REG, OP_REG(RAX));
 
 	E();
@@ -44,10 +62,19 @@ C_I(LW) {
 		E();
 	}
 
+	size_t miss, done;
 	A_RS1(MOV, OP_REG(RSI), OP_RELOC_RV_REG);
 	A_IMM(ADD, OP_REG(RSI), OP_RELOC_IMM32);
-	EMU_FUNCTION(6);
+	PAGE_CACHE_LOOKUP(4, PAGE_CACHE_READ_TAG, miss);
+	A(MOVSX, OP_REG(RAX), OP_DEREF(RSI));
+	J_FWD(JMP, done);
+
+	L_FWD(miss);
+	A(MOV, OP_REG(RDX), OP_REG(RAX));
+	EMU_FUNCTION(-11);
 	A(MOVSX, OP_REG(RAX), OP_REG(RAX));
+
+	L_FWD(done);
 	A_RD(MOV, OP_RELOC_RV_REG, OP_REG(RAX));
 
 	E();
@@ -60,9 +87,18 @@ C_I(LD) {
 		E();
 	}
 
+	size_t miss, done;
 	A_RS1(MOV, OP_REG(RSI), OP_RELOC_RV_REG);
 	A_IMM(ADD, OP_REG(RSI), OP_RELOC_IMM32);
-	EMU_FUNCTION(7);
+	PAGE_CACHE_LOOKUP(8, PAGE_CACHE_READ_TAG, miss);
+	A(MOV, OP_REG(RAX), OP_DEREF(RSI));
+	J_FWD(JMP, done);
+
+	L_FWD(miss);
+	A(MOV, OP_REG(RDX), OP_REG(RAX));
+	EMU_FUNCTION(-12);
+
+	L_FWD(done);
 	A_RD(MOV, OP_RELOC_RV_REG, OP_REG(RAX));
 
 	E();
@@ -75,10 +111,19 @@ C_I(LBU) {
 		E();
 	}
 
+	size_t miss, done;
 	A_RS1(MOV, OP_REG(RSI), OP_RELOC_RV_REG);
 	A_IMM(ADD, OP_REG(RSI), OP_RELOC_IMM32);
-	EMU_FUNCTION(4);
+	PAGE_CACHE_LOOKUP(1, PAGE_CACHE_READ_TAG, miss);
+	A(MOVZX8, OP_REG(RAX), OP_DEREF(RSI));
+	J_FWD(JMP, done);
+
+	L_FWD(miss);
+	A(MOV, OP_REG(RDX), OP_REG(RAX));
+	EMU_FUNCTION(-9);
 	A(AND, OP_IMM(0xff), 0);
+
+	L_FWD(done);
 	A_RD(MOV, OP_RELOC_RV_REG, OP_REG(RAX));
 
 	E();
@@ -91,10 +136,19 @@ C_I(LHU) {
 		E();
 	}
 
+	size_t miss, done;
 	A_RS1(MOV, OP_REG(RSI), OP_RELOC_RV_REG);
 	A_IMM(ADD, OP_REG(RSI), OP_RELOC_IMM32);
-	EMU_FUNCTION(5);
+	PAGE_CACHE_LOOKUP(2, PAGE_CACHE_READ_TAG, miss);
+	A(MOVZX16, OP_REG(RAX), OP_DEREF(RSI));
+	J_FWD(JMP, done);
+
+	L_FWD(miss);
+	A(MOV, OP_REG(RDX), OP_REG(RAX));
+	EMU_FUNCTION(-10);
 	A(AND, OP_IMM(0xffff), 0);
+
+	L_FWD(done);
 	A_RD(MOV, OP_RELOC_RV_REG, OP_REG(RAX));
 
 	E();
@@ -107,10 +161,19 @@ C_I(LWU) {
 		E();
 	}
 
+	size_t miss, done;
 	A_RS1(MOV, OP_REG(RSI), OP_RELOC_RV_REG);
 	A_IMM(ADD, OP_REG(RSI), OP_RELOC_IMM32);
-	EMU_FUNCTION(6);
+	PAGE_CACHE_LOOKUP(4, PAGE_CACHE_READ_TAG, miss);
+	A(MOVZX, OP_REG(RAX), OP_DEREF(RSI));
+	J_FWD(JMP, done);
+
+	L_FWD(miss);
+	A(MOV, OP_REG(RDX), OP_REG(RAX));
+	EMU_FUNCTION(-11);
 	A(MOVZX, OP_REG(RAX), OP_REG(RAX));
+
+	L_FWD(done);
 	A_RD(MOV, OP_RELOC_RV_REG, OP_REG(RAX));
 
 	E();
@@ -324,6 +387,7 @@ C_I(JALR) {
 		A_RD(MOV, OP_RELOC_RV_REG, OP_REG(RCX));
 	}
 
+	A(MOV, OP_REG(R13), OP_REG(R9));
 	A(MOV, OP_REG(R9), OP_REG(RAX));
 	E_J();
 }
@@ -12,6 +12,7 @@ C_J(JAL) {
 		A_RD(MOV, OP_RELOC_RV_REG, OP_REG(RAX));
 	}
 
+	A(MOV, OP_REG(R13), OP_REG(R9));
 	A_IMM(ADD, OP_REG(R9), OP_RELOC_IMM32);
 	E_J();
 }
@@ -8,44 +8,76 @@
 C_S(SB) {
 	S_S();
 
+	size_t miss, done;
 	A_RS1(MOV, OP_REG(RSI), OP_RELOC_RV_REG);
 	A_IMM(ADD, OP_REG(RSI), OP_RELOC_IMM32);
 	A_RS2(MOV, OP_REG(RDX), OP_RELOC_RV_REG);
-	EMU_FUNCTION(0);
+	PAGE_CACHE_LOOKUP(1, PAGE_CACHE_WRITE_TAG, miss);
+	A(MOV8, OP_DEREF(RSI), OP_REG(RDX));
+	J_FWD(JMP, done);
 
+	L_FWD(miss);
+	A(MOV, OP_REG(RCX), OP_REG(RAX));
+	EMU_FUNCTION(-5);
+
+	L_FWD(done);
 	E();
 }
 
 C_S(SH) {
 	S_S();
 
+	size_t miss, done;
 	A_RS1(MOV, OP_REG(RSI), OP_RELOC_RV_REG);
 	A_IMM(ADD, OP_REG(RSI), OP_RELOC_IMM32);
 	A_RS2(MOV, OP_REG(RDX), OP_RELOC_RV_REG);
-	EMU_FUNCTION(1);
+	PAGE_CACHE_LOOKUP(2, PAGE_CACHE_WRITE_TAG, miss);
+	A(MOV16, OP_DEREF(RSI), OP_REG(RDX));
+	J_FWD(JMP, done);
+
+	L_FWD(miss);
+	A(MOV, OP_REG(RCX), OP_REG(RAX));
+	EMU_FUNCTION(-6);
 
+	L_FWD(done);
 	E();
 }
 
 C_S(SW) {
 	S_S();
 
+	size_t miss, done;
 	A_RS1(MOV, OP_REG(RSI), OP_RELOC_RV_REG);
 	A_IMM(ADD, OP_REG(RSI), OP_RELOC_IMM32);
 	A_RS2(MOV, OP_REG(RDX), OP_RELOC_RV_REG);
-	EMU_FUNCTION(2);
+	PAGE_CACHE_LOOKUP(4, PAGE_CACHE_WRITE_TAG, miss);
+	A(MOV32, OP_DEREF(RSI), OP_REG(RDX));
+	J_FWD(JMP, done);
 
+	L_FWD(miss);
+	A(MOV, OP_REG(RCX), OP_REG(RAX));
+	EMU_FUNCTION(-7);
+
+	L_FWD(done);
 	E();
 }
 
 C_S(SD) {
 	S_S();
 
+	size_t miss, done;
 	A_RS1(MOV, OP_REG(RSI), OP_RELOC_RV_REG);
 	A_IMM(ADD, OP_REG(RSI), OP_RELOC_IMM32);
 	A_RS2(MOV, OP_REG(RDX), OP_RELOC_RV_REG);
-	EMU_FUNCTION(3);
+	PAGE_CACHE_LOOKUP(8, PAGE_CACHE_WRITE_TAG, miss);
+	A(MOV, OP_DEREF(RSI), OP_REG(RDX));
+	J_FWD(JMP, done);
+
+	L_FWD(miss);
+	A(MOV, OP_REG(RCX), OP_REG(RAX));
+	EMU_FUNCTION(-8);
 
+	L_FWD(done);
 	E();
 }
 
@@ -48,6 +48,39 @@ L(MOVZX){
 	EOL,
 };
 
+L(MOVZX16){
+	{0xB70F, 2, 0, true, O(R64), O(RM64)},
+	EOL,
+};
+
+L(MOVZX8){
+	{0xB60F, 2, 0, true, O(R64), O(RM64)},
+	EOL,
+};
+
+/* NOTE : MOV32, MOV16 and MOV8 are only used to store the lower part of a register to memory
+ *        for the same reason as MOVSX16 and MOVSX8, we hardcode the operand size using a
+ *        different mnemonic
+ */
+L(MOV32){
+	{0x89, 1, 0, false, O(RM64), O(R64)},
+	EOL,
+};
+
+L(MOV16){
+	/* NOTE : the assembler doesn't support legacy prefixes, we emit the operand-size override
+	 *        prefix as the first byte of the opcode : this is only valid when no REX prefix is
+	 *        required, i.e. when only the registers RAX to RDI are used
+	 */
+	{0x8966, 2, 0, false, O(RM64), O(R64)},
+	EOL,
+};
+
+L(MOV8){
+	{0x88, 1, 0, false, O(RM64), O(R64)},
+	EOL,
+};
+
 L(ADD){
 	{0x01, 1, 0, true, O(RM64), O(R64)},
 	{0x03, 1, 0, true, O(R64), O(RM64)},
@@ -118,6 +118,11 @@ typedef uint64_t x86_operand_t;
 	X(MOVSX16)      \
 	X(MOVSX8)       \
 	X(MOVZX)        \
+	X(MOVZX16)      \
+	X(MOVZX8)       \
+	X(MOV32)        \
+	X(MOV16)        \
+	X(MOV8)         \
 	X(ADD)          \
 	X(SUB)          \
 	X(NEG)          \
@@ -2,6 +2,9 @@
 
 .globl dr_entry
 dr_entry:
+	// RBX points to the page cache used by the loads and stores
+	mov %r8, %rax
+
 	/* R8 points to x16 to make sure all the registers are available
 	 * with a [-128;127] disp
 	 */
@@ -14,14 +17,22 @@ dr_entry:
 	 *        if we end up using other ones, make sure to backup
 	 *        them properly
 	 */
-	//push %rbx
+	push %rbx
 	//push %rbp
 	push %r12
-	//push %r13
+	push %r13
 	push %r14
 	push %r15
+	/* The five pushes keep the stack in the same alignment as it was on
+	 * the `call` to dr_entry, the wrappers rely on it
+	 */
 
 	mov %rdi, %r12
+	mov %rax, %rbx
+	/* R13 is set to the PC of the instruction leaving the block, if any,
+	 * by the jumps, the taken branches and the short-circuits
+	 */
+	mov $1, %r13d
 
 	jmp *%rsi
 
@@ -30,18 +41,19 @@ dr_exit:
 	 *        already cached
 	 */
 	mov %r9, %rax
+	mov %r13, %rdx
 
 	pop %r15
 	pop %r14
-	//pop %r13
+	pop %r13
 	pop %r12
 	//pop %rbp
-	//pop %rbx
+	pop %rbx
 
 	ret
 
-.macro DR_WX_WRAPPER size
-dr_emu_w\size\()_wrapper:
+.macro DR_WX_WRAPPER name
+dr_\name\()_wrapper:
 	// We save the current PC to emu->cpu.pc
 	mov %r9, 0(%r12)
 	// We pass the emu as the first argument
@@ -57,7 +69,7 @@ dr_emu_w\size\()_wrapper:
 	 * 8-byte aligned
 	 */
 	sub $8, %rsp
-	call emu_w\size
+	call \name
 	add $8, %rsp
 
 	mov 8(%r12), %dil /* jump_pending */
@@ -137,14 +149,19 @@ dr_wrappers_short_circuit:
 	pop %r8
 	add $8, %rsp
 
-	// We read back the new PC to r9
+	// We read back the new PC to r9, the PC of the instruction is kept in r13
+	mov %r9, %r13
 	mov 0(%r12), %r9
 	jmp *%r10
 
-DR_WX_WRAPPER 8
-DR_WX_WRAPPER 16
-DR_WX_WRAPPER 32
-DR_WX_WRAPPER 64
+DR_WX_WRAPPER emu_w8
+DR_WX_WRAPPER emu_w16
+DR_WX_WRAPPER emu_w32
+DR_WX_WRAPPER emu_w64
+DR_WX_WRAPPER dr_page_cache_w8
+DR_WX_WRAPPER dr_page_cache_w16
+DR_WX_WRAPPER dr_page_cache_w32
+DR_WX_WRAPPER dr_page_cache_w64
 
 DR_WRAPPER emu_r8
 DR_WRAPPER emu_r16
@@ -161,9 +178,23 @@ DR_WRAPPER cpu_mret
 DR_WRAPPER cpu_sret
 DR_WRAPPER cpu_wfi
 DR_WRAPPER mmu_vg2pg_flush_tlb
+DR_WRAPPER dr_idiom_execute
+DR_WRAPPER dr_page_cache_r8
+DR_WRAPPER dr_page_cache_r16
+DR_WRAPPER dr_page_cache_r32
+DR_WRAPPER dr_page_cache_r64
 
 // We use negative offsets to keep all the functions accessible with a [-128;127] disp
 .section .data
+	.quad dr_dr_page_cache_r64_wrapper   /* [-12] */
+	.quad dr_dr_page_cache_r32_wrapper   /* [-11] */
+	.quad dr_dr_page_cache_r16_wrapper   /* [-10] */
+	.quad dr_dr_page_cache_r8_wrapper    /* [-9] */
+	.quad dr_dr_page_cache_w64_wrapper   /* [-8] */
+	.quad dr_dr_page_cache_w32_wrapper   /* [-7] */
+	.quad dr_dr_page_cache_w16_wrapper   /* [-6] */
+	.quad dr_dr_page_cache_w8_wrapper    /* [-5] */
+	.quad dr_dr_idiom_execute_wrapper    /* [-4] */
 	.quad dr_mmu_vg2pg_flush_tlb_wrapper /* [-3] */
 	.quad dr_cpu_sret_wrapper            /* [-2] */
 	.quad dr_cpu_wfi_wrapper             /* [-1] */
@@ -1,3 +1,5 @@
+#define _GNU_SOURCE
+
 #include <assert.h>
 #include <endian.h>
 #include <inttypes.h>
@@ -7,6 +9,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/mman.h>
+#include <sys/select.h>
 #include <time.h>
 #include <unistd.h>
 
@@ -18,7 +21,99 @@
 #include "mmu_paging_guest_to_guest.h"
 #include "mmu_paging_guest_to_host.h"
 
-void emu_create(emulator_t* emu, guest_reg pc, size_t cache_bits, size_t device_update_period, bool dynarec_enabled, bool user_only_mode) {
+void* emu_alloc_cache(size_t size) {
+	void* cache = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, 0, 0);
+	if (cache == MAP_FAILED) {
+		perror("mmap");
+		abort();
+	}
+	return cache;
+}
+
+void emu_clear_cache(void* cache, size_t size) {
+	// NOTE : the pages of large caches are given back to the host, they are zero-filled again on their next access
+	if (size < EMU_CACHE_CLEAR_MADVISE_SIZE || madvise(cache, size, MADV_DONTNEED) != 0) {
+		memset(cache, 0, size);
+	}
+}
+
+void emu_free_cache(void* cache, size_t size) {
+	munmap(cache, size);
+}
+
+size_t emu_instruction_cache_size(const emulator_t* emu) {
+	size_t entries = emu->cpu.instruction_cache_mask + 1;
+#ifdef RISCV_EMULATOR_DYNAREC_X86_64_SUPPORT
+	if (emu->cpu.dynarec_enabled) {
+		return entries * sizeof(emu->cpu.instruction_cache.as_dr_ins[0]);
+	}
+#endif
+	return entries * sizeof(emu->cpu.instruction_cache.as_cached_ins[0]);
+}
+
+static void emu_allocate_cache_entries(emulator_t* emu, emu_cache_t cache, size_t bits) {
+	if (bits > EMU_CACHE_BITS_MAX) {
+		fprintf(stderr, "The number of significant bits for the caches is over %d bits\n", EMU_CACHE_BITS_MAX);
+		abort();
+	}
+
+	const guest_paddr mask = (1ull << bits) - 1;
+	emu->cache_bits[cache] = bits;
+	switch (cache) {
+		case EMU_CACHE_INSTRUCTION:
+			emu->cpu.instruction_cache_mask = mask;
+			emu->cpu.instruction_cache.as_ptr = emu_alloc_cache(emu_instruction_cache_size(emu));
+			break;
+		case EMU_CACHE_PG2H_TLB:
+			emu->pg2h_tlb = emu_alloc_cache((mask + 1) * sizeof(emu->pg2h_tlb[0]));
+			emu->pg2h_tlb_mask = mask;
+			break;
+		case EMU_CACHE_VG2PG_TLB:
+			emu->cpu.vg2pg_tlb = emu_alloc_cache((mask + 1) * sizeof(emu->cpu.vg2pg_tlb[0]));
+			emu->cpu.vg2pg_tlb_mask = mask;
+			break;
+		case EMU_CACHE_VG2H_TLB:
+			// NOTE : the pages of the TLBs are zero-filled by the host on their first access, zero is an invalid tag
+			emu->cpu.vg2h_tlb = emu_alloc_cache(MMU_VG2H_CONTEXT_COUNT * (mask + 1) * sizeof(emu->cpu.vg2h_tlb[0]));
+			emu->cpu.vg2h_itlb = emu_alloc_cache(MMU_VG2H_CONTEXT_COUNT * (mask + 1) * sizeof(emu->cpu.vg2h_itlb[0]));
+			emu->cpu.vg2h_tlb_mask = mask;
+			emu->cpu.vg2h_tlb_used = 0;
+			emu->cpu.vg2h_itlb_used = 0;
+			break;
+		default:
+			fprintf(stderr, "Unknown cache %d\n", cache);
+			abort();
+	}
+}
+
+static void emu_free_cache_entries(emulator_t* emu, emu_cache_t cache) {
+	switch (cache) {
+		case EMU_CACHE_INSTRUCTION:
+			emu_free_cache(emu->cpu.instruction_cache.as_ptr, emu_instruction_cache_size(emu));
+			break;
+		case EMU_CACHE_PG2H_TLB:
+			emu_free_cache(emu->pg2h_tlb, (emu->pg2h_tlb_mask + 1) * sizeof(emu->pg2h_tlb[0]));
+			break;
+		case EMU_CACHE_VG2PG_TLB:
+			emu_free_cache(emu->cpu.vg2pg_tlb, (emu->cpu.vg2pg_tlb_mask + 1) * sizeof(emu->cpu.vg2pg_tlb[0]));
+			break;
+		case EMU_CACHE_VG2H_TLB: {
+			size_t tlb_size = emu->cpu.vg2h_tlb_mask + 1;
+			emu_free_cache(emu->cpu.vg2h_tlb, MMU_VG2H_CONTEXT_COUNT * tlb_size * sizeof(emu->cpu.vg2h_tlb[0]));
+			emu_free_cache(emu->cpu.vg2h_itlb, MMU_VG2H_CONTEXT_COUNT * tlb_size * sizeof(emu->cpu.vg2h_itlb[0]));
+			break;
+		}
+		default:
+			fprintf(stderr, "Unknown cache %d\n", cache);
+			abort();
+	}
+}
+
+void emu_create(emulator_t* emu, guest_reg pc, const size_t cache_bits[EMU_CACHE_COUNT], bool adaptive_caches,
+		size_t device_update_period, bool dynarec_enabled, bool user_only_mode) {
+	emu->pg2h_ram_regions_len = 0;
+	emu->pg2h_dirty_log_enabled = false;
+	emu->pg2h_dedup_enabled = false;
 	emu->pg2h_paging_table = 0;
 
 	memset(&emu->cpu, 0, sizeof(emu->cpu));
@@ -26,42 +121,25 @@ void emu_create(emulator_t* emu, guest_reg pc, size_t cache_bits, size_t device_
 	emu->cpu.priv_mode = user_only_mode ? UO_MODE : M_MODE;
 	emu->cpu.dynarec_enabled = dynarec_enabled;
 
-	if (cache_bits > 24) {
-		fprintf(stderr, "The number of significant bits for the caches is over 24 bits\n");
-		abort();
-	}
-
-	const guest_paddr caches_mask = (1ull << cache_bits) - 1;
-
-	size_t instruction_cache_size;
+#ifndef RISCV_EMULATOR_DYNAREC_X86_64_SUPPORT
 	if (dynarec_enabled) {
-#ifdef RISCV_EMULATOR_DYNAREC_X86_64_SUPPORT
-		instruction_cache_size = (1ull << cache_bits) *
-					 sizeof(emu->cpu.instruction_cache.as_dr_ins[0]);
-#else
 		fprintf(stderr, "Dynarec support isn't enabled\n");
 		abort();
+	}
 #endif
-	} else {
-		instruction_cache_size = (1ull << cache_bits) *
-					 sizeof(emu->cpu.instruction_cache.as_cached_ins[0]);
-	}
-	emu->cpu.instruction_cache.as_ptr = malloc(instruction_cache_size);
-	emu->cpu.instruction_cache_mask = caches_mask;
-	assert(emu->cpu.instruction_cache.as_ptr != NULL);
-	memset(emu->cpu.instruction_cache.as_ptr, 0, instruction_cache_size);
-
-	const size_t pg2h_tlb_size = (1ull << cache_bits) * sizeof(emu->pg2h_tlb[0]);
-	emu->pg2h_tlb = malloc(pg2h_tlb_size);
-	emu->pg2h_tlb_mask = caches_mask;
-	assert(emu->pg2h_tlb != NULL);
-	memset(emu->pg2h_tlb, 0, pg2h_tlb_size);
-
-	const size_t vg2pg_tlb_size = (1ull << cache_bits) * sizeof(emu->cpu.vg2pg_tlb[0]);
-	emu->cpu.vg2pg_tlb = malloc(vg2pg_tlb_size);
-	emu->cpu.vg2pg_tlb_mask = caches_mask;
-	assert(emu->cpu.vg2pg_tlb != NULL);
-	memset(emu->cpu.vg2pg_tlb, 0, vg2pg_tlb_size);
+	for (emu_cache_t cache = 0; cache < EMU_CACHE_COUNT; cache++) {
+		emu_allocate_cache_entries(emu, cache, cache_bits[cache]);
+		emu->cache_misses[cache] = 0;
+		emu->cache_quiet_periods[cache] = 0;
+	}
+	emu->adaptive_caches = adaptive_caches;
+	emu->cache_period_retired = 0;
+
+	/* NOTE : this computes the initial translation mode, selects the unified TLBs and empties the page
+	 *        cache of the dynarec and the page-walk cache as a zeroed tag is a valid page base
+	 */
+	mmu_vg2h_flush_tlb(emu);
+	mmu_vg2pg_context_changed(emu);
 
 	emu->mmio_devices = NULL;
 	emu->mmio_devices_capacity = emu->mmio_devices_len = 0;
@@ -71,8 +149,8 @@ void emu_create(emulator_t* emu, guest_reg pc, size_t cache_bits, size_t device_
 		fprintf(stderr, "The device update period is over 2^24\n");
 		abort();
 	}
-	emu->device_update_iter = 0;
-	emu->device_update_iter_mask = (1 << device_update_period) - 1;
+	emu->device_update_countdown = 0;
+	emu->device_update_period = 1ull << device_update_period;
 
 #ifdef RISCV_EMULATOR_SDL_SUPPORT
 	memset(&emu->sdl_data, 0, sizeof(emu->sdl_data));
@@ -80,6 +158,7 @@ void emu_create(emulator_t* emu, guest_reg pc, size_t cache_bits, size_t device_
 
 	emu->running = true;
 	emu->reboot = false;
+	emu->stop_requested = 0;
 }
 
 void emu_destroy(emulator_t* emu) {
@@ -96,39 +175,112 @@ void emu_destroy(emulator_t* emu) {
 		dr_free(emu);
 	}
 #endif
-	free(emu->cpu.instruction_cache.as_ptr);
-	free(emu->pg2h_tlb);
-	free(emu->cpu.vg2pg_tlb);
+	for (emu_cache_t cache = 0; cache < EMU_CACHE_COUNT; cache++) {
+		emu_free_cache_entries(emu, cache);
+	}
 #ifdef RISCV_EMULATOR_SDL_SUPPORT
 	emu_sdl_destory(emu);
 #endif
 }
 
-bool emu_map_memory(emulator_t* emu, guest_paddr base, size_t size) {
+static uint8_t* emu_mmap_memory(size_t size, emu_huge_pages_t huge_pages) {
+	if (huge_pages == EMU_HUGE_PAGES_HUGETLB) {
+		if ((size & (EMU_HUGE_PAGE_SIZE - 1)) == 0) {
+			uint8_t* pool = mmap(NULL, size, PROT_READ | PROT_WRITE,
+					     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, 0, 0);
+			if (pool != MAP_FAILED) {
+				return pool;
+			}
+		}
+		fprintf(stderr, "Unable to allocate hugetlbfs pages, falling back to transparent huge pages\n");
+		huge_pages = EMU_HUGE_PAGES_THP;
+	}
+
+	if (huge_pages == EMU_HUGE_PAGES_THP && size >= EMU_HUGE_PAGE_SIZE) {
+		// NOTE : the pool is over-allocated to align it on a huge page boundary, the host can't use huge pages otherwise
+		size_t mapping_size = size + EMU_HUGE_PAGE_SIZE;
+		uint8_t* mapping = mmap(NULL, mapping_size, PROT_READ | PROT_WRITE,
+					MAP_PRIVATE | MAP_ANONYMOUS, 0, 0);
+		if (mapping == MAP_FAILED) {
+			return MAP_FAILED;
+		}
+
+		uint8_t* pool = (uint8_t*)(((uintptr_t)mapping + EMU_HUGE_PAGE_SIZE - 1) & ~(EMU_HUGE_PAGE_SIZE - 1));
+		if (pool != mapping) {
+			munmap(mapping, pool - mapping);
+		}
+		if (pool + size != mapping + mapping_size) {
+			munmap(pool + size, (mapping + mapping_size) - (pool + size));
+		}
+		// NOTE : a failing madvise isn't fatal, the memory is then backed by regular pages
+		madvise(pool, size, MADV_HUGEPAGE);
+		return pool;
+	}
+
+	return mmap(NULL, size, PROT_READ | PROT_WRITE,
+		    MAP_PRIVATE | MAP_ANONYMOUS, 0, 0);
+}
+
+static uint8_t* emu_mmap_shared_memory(size_t size, int* memfd) {
+	*memfd = memfd_create("riscv-emulator-ram", MFD_CLOEXEC);
+	if (*memfd < 0) {
+		perror("memfd_create");
+		return MAP_FAILED;
+	}
+	if (ftruncate(*memfd, size) != 0) {
+		perror("ftruncate");
+		close(*memfd);
+		return MAP_FAILED;
+	}
+
+	uint8_t* pool = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, *memfd, 0);
+	if (pool == MAP_FAILED) {
+		perror("mmap");
+		close(*memfd);
+	}
+	return pool;
+}
+
+bool emu_map_memory(emulator_t* emu, guest_paddr base, size_t size, emu_huge_pages_t huge_pages, emu_dedup_t dedup) {
 	if ((base & MMU_PG2H_OFFSET_MASK) != 0 ||
 	    (size & MMU_PG2H_OFFSET_MASK) != 0) {
 		return false;
 	}
 
-	uint8_t* pool = mmap(NULL, size, PROT_READ | PROT_WRITE,
-			     MAP_PRIVATE | MAP_ANONYMOUS, 0, 0);
+	int memfd = -1;
+	uint8_t* pool;
+	if (dedup == EMU_DEDUP_COW) {
+		if (huge_pages != EMU_HUGE_PAGES_NONE) {
+			fprintf(stderr, "Huge pages can't be deduplicated, the memory is backed by regular pages\n");
+		}
+		pool = emu_mmap_shared_memory(size, &memfd);
+	} else {
+		pool = emu_mmap_memory(size, huge_pages);
+	}
 	if (pool == MAP_FAILED) {
 		return false;
 	}
 
-	for (size_t i = 0; i < size / MMU_PG2H_PAGE_SIZE; i++) {
-		if (!mmu_pg2h_map(emu, base + (i * MMU_PG2H_PAGE_SIZE), pool + (i * MMU_PG2H_PAGE_SIZE))) {
-			for (size_t j = 0; j < i; j++) {
-				mmu_pg2h_unmap(emu, base + (j * MMU_PG2H_PAGE_SIZE));
-			}
-			munmap(pool, size);
-			return false;
+	if (dedup == EMU_DEDUP_KSM && madvise(pool, size, MADV_MERGEABLE) != 0) {
+		// NOTE : a failing madvise isn't fatal, the host kernel may have been built without KSM
+		perror("madvise");
+	}
+
+	if (!mmu_pg2h_map_ram(emu, base, size, pool, memfd)) {
+		munmap(pool, size);
+		if (memfd >= 0) {
+			close(memfd);
 		}
+		return false;
 	}
 
 	return true;
 }
 
+size_t emu_dedup_memory(emulator_t* emu) {
+	return mmu_pg2h_dedup(emu);
+}
+
 bool emu_add_mmio_device(emulator_t* emu, guest_paddr base, size_t size, const device_mmio_t* device) {
 	if ((base & MMU_PG2H_OFFSET_MASK) != 0 ||
 	    (size & MMU_PG2H_OFFSET_MASK) != 0) {
@@ -166,92 +318,296 @@ void emu_update_mmio_devices(emulator_t* emu) {
 	}
 }
 
+void emu_idle(emulator_t* emu, uint64_t max_wait_ns) {
+	uint64_t wait_ns = max_wait_ns;
+	fd_set wake_fds;
+	FD_ZERO(&wake_fds);
+	int max_fd = -1;
+
+	for (size_t i = 0; i < emu->mmio_devices_len; i++) {
+		if (emu->mmio_devices[i].idle_handler != NULL) {
+			int wake_fd = -1;
+			uint64_t device_wait_ns = emu->mmio_devices[i].idle_handler(emu, emu->mmio_devices[i].device_data, &wake_fd);
+			if (device_wait_ns < wait_ns) {
+				wait_ns = device_wait_ns;
+			}
+			if (wake_fd >= 0 && wake_fd < FD_SETSIZE) {
+				FD_SET(wake_fd, &wake_fds);
+				max_fd = wake_fd > max_fd ? wake_fd : max_fd;
+			}
+		}
+	}
+
+	if (wait_ns > 0) {
+		struct timeval timeout = {
+			.tv_sec = wait_ns / 1000000000,
+			.tv_usec = (wait_ns % 1000000000) / 1000,
+		};
+		select(max_fd + 1, &wake_fds, NULL, NULL, &timeout);
+	}
+
+	emu_update_mmio_devices(emu);
+}
+
+static uint64_t emu_host_time_ns(void) {
+	struct timespec tp;
+	clock_gettime(CLOCK_MONOTONIC, &tp);
+	return tp.tv_sec * 1000000000ull + tp.tv_nsec;
+}
+
+void emu_resize_cache(emulator_t* emu, emu_cache_t cache, size_t bits) {
+	// NOTE : the emitted code of the dynarec is referenced by the instruction cache and has to be dropped first
+	if (cache == EMU_CACHE_INSTRUCTION) {
+		cpu_flush_instruction_cache(emu);
+	}
+
+	emu_free_cache_entries(emu, cache);
+	emu_allocate_cache_entries(emu, cache, bits);
+	emu->cache_misses[cache] = 0;
+	emu->cache_quiet_periods[cache] = 0;
+
+	switch (cache) {
+		case EMU_CACHE_INSTRUCTION:
+			break;
+		case EMU_CACHE_PG2H_TLB:
+			// NOTE : the TLBs derived from the PG2H translations don't depend on the entries of its TLB
+			break;
+		case EMU_CACHE_VG2PG_TLB:
+			mmu_vg2pg_flush_tlb(emu);
+			break;
+		case EMU_CACHE_VG2H_TLB:
+			// NOTE : this points the current contexts to the new TLBs and fills them with invalid tags
+			mmu_vg2h_flush_tlb(emu);
+			mmu_vg2pg_context_changed(emu);
+			break;
+		default:
+			break;
+	}
+}
+
+void emu_adapt_caches(emulator_t* emu) {
+	for (emu_cache_t cache = 0; cache < EMU_CACHE_COUNT; cache++) {
+		size_t bits = emu->cache_bits[cache];
+		uint64_t entries = 1ull << bits;
+		uint64_t misses = emu->cache_misses[cache];
+		emu->cache_misses[cache] = 0;
+
+		/* A cache missing more often than it has entries is thrashing, a cache almost never missing during
+		 * a few periods in a row is wasting host memory and cache lines
+		 */
+		if (misses > entries) {
+			emu->cache_quiet_periods[cache] = 0;
+			if (bits < EMU_CACHE_BITS_MAX) {
+				emu_resize_cache(emu, cache, bits + 1);
+			}
+		} else if (misses < entries / EMU_CACHE_SHRINK_RATIO) {
+			if (++emu->cache_quiet_periods[cache] >= EMU_CACHE_SHRINK_PERIODS && bits > EMU_CACHE_BITS_MIN) {
+				emu_resize_cache(emu, cache, bits - 1);
+			}
+		} else {
+			emu->cache_quiet_periods[cache] = 0;
+		}
+	}
+}
+
+emu_exit_reason_t emu_run(emulator_t* emu, uint64_t max_instructions, uint64_t max_host_time_ns) {
+	uint64_t deadline = EMU_RUN_UNLIMITED;
+	if (max_host_time_ns != EMU_RUN_UNLIMITED) {
+		deadline = emu_host_time_ns() + max_host_time_ns;
+	}
+
+	uint64_t retired = 0;
+	for (uint64_t iter = 0;; iter++) {
+		if (!emu->running) {
+			return EMU_EXIT_HALTED;
+		}
+		if (emu->stop_requested) {
+			emu->stop_requested = 0;
+			return EMU_EXIT_STOP_REQUESTED;
+		}
+		if (retired >= max_instructions) {
+			return EMU_EXIT_BUDGET;
+		}
+		if (deadline != EMU_RUN_UNLIMITED && (iter & (EMU_RUN_TIME_CHECK_PERIOD - 1)) == 0 &&
+		    emu_host_time_ns() >= deadline) {
+			return EMU_EXIT_TIMEOUT;
+		}
+
+		uint64_t executed = cpu_execute(emu, max_instructions - retired);
+		retired += executed;
+
+		// NOTE : no instruction is being executed between two calls to `cpu_execute`, the caches can be resized safely
+		if (emu->adaptive_caches) {
+			emu->cache_period_retired += executed;
+			if (emu->cache_period_retired >= EMU_CACHE_ADAPT_PERIOD) {
+				emu->cache_period_retired = 0;
+				emu_adapt_caches(emu);
+			}
+		}
+	}
+}
+
+void emu_request_stop(emulator_t* emu) {
+	emu->stop_requested = 1;
+}
+
 static inline bool emu_paging_should_translate(emulator_t* emu, bool with_mprv) {
-	bool mprv = (emu->cpu.csrs.mstatus >> 17) & 1;
-	privilege_mode_t mpp = (emu->cpu.csrs.mstatus >> 11) & 3;
-	return ((emu->cpu.csrs.satp >> 60) != 0) &&  // not bare
-	       ((emu->cpu.priv_mode == S_MODE) ||
-		(emu->cpu.priv_mode == U_MODE) ||
-		(with_mprv && mprv && (mpp == S_MODE || mpp == U_MODE)));
+	return emu->cpu.vg2pg_mode & (with_mprv ? MMU_VG2PG_MODE_TRANSLATE_DATA : MMU_VG2PG_MODE_TRANSLATE_FETCH);
 }
 
 #define le8toh(x) (x)
 #define htole8(x) (x)
 
-#define EMU_RX_MISALIGNED(SIZE, TYPE)                                                      \
-	static inline TYPE emu_r##SIZE##_misaligned(emulator_t* emu, guest_vaddr vaddr) {  \
-		TYPE value = 0;                                                            \
-		for (size_t i = 0; i < sizeof(TYPE) && !emu->cpu.exception_pending; i++) { \
-			value |= (TYPE)emu_r8(emu, vaddr + i) << (i * 8);                  \
-		}                                                                          \
-		return value;                                                              \
-	}
-
-#define EMU_RX(SIZE, TYPE)                                                                \
-	TYPE emu_r##SIZE(emulator_t* emu, guest_vaddr vaddr) {                            \
-		size_t offset = vaddr & MMU_PG2H_OFFSET_MASK;                             \
-		if ((offset & (sizeof(TYPE) - 1)) != 0) {                                 \
-			return emu_r##SIZE##_misaligned(emu, vaddr);                      \
-		}                                                                         \
-		/* Read across page boudaries should be handled by the misaligned case */ \
-		assert(offset + sizeof(TYPE) <= MMU_PG2H_PAGE_SIZE);                      \
-                                                                                          \
-		guest_paddr paddr;                                                        \
-		if (emu_paging_should_translate(emu, true)) {                             \
-			if (!mmu_vg2pg_translate(emu, MMU_VG2PG_ACCESS_READ,              \
-						 vaddr, &paddr)) {                        \
-				cpu_throw_exception(emu, EXC_LOAD_PAGE_FAULT, vaddr);     \
-				return 0;                                                 \
-			}                                                                 \
-		} else {                                                                  \
-			paddr = vaddr;                                                    \
-		}                                                                         \
-                                                                                          \
-		TYPE value;                                                               \
-		if (!emu_physical_r##SIZE(emu, paddr, &value)) {                          \
-			cpu_throw_exception(emu, EXC_LOAD_ACCESS_FAULT, paddr);           \
-			return 0;                                                         \
-		} else {                                                                  \
-			return value;                                                     \
-		}                                                                         \
-	}
-
-#define EMU_WX_MISALIGNED(SIZE, TYPE)                                                                 \
-	static inline bool emu_w##SIZE##_misaligned(emulator_t* emu, guest_vaddr vaddr, TYPE value) { \
-		bool ret = false;                                                                     \
-		for (size_t i = 0; i < sizeof(TYPE) && !emu->cpu.exception_pending; i++) {            \
-			ret |= emu_w8(emu, vaddr + i, value & 0xff);                                  \
-			value >>= 8;                                                                  \
-		}                                                                                     \
-		return ret;                                                                           \
-	}
-
-#define EMU_WX(SIZE, TYPE)                                                                 \
-	bool emu_w##SIZE(emulator_t* emu, guest_vaddr vaddr, TYPE value) {                 \
-		size_t offset = vaddr & MMU_PG2H_OFFSET_MASK;                              \
-		if ((offset & (sizeof(TYPE) - 1)) != 0) {                                  \
-			return emu_w##SIZE##_misaligned(emu, vaddr, value);                \
-		}                                                                          \
-		/* Write across page boudaries should be handled by the misaligned case */ \
-		assert(offset + sizeof(TYPE) <= MMU_PG2H_PAGE_SIZE);                       \
-                                                                                           \
-		guest_paddr paddr;                                                         \
-		if (emu_paging_should_translate(emu, true)) {                              \
-			if (!mmu_vg2pg_translate(emu, MMU_VG2PG_ACCESS_WRITE,              \
-						 vaddr, &paddr)) {                         \
-				cpu_throw_exception(emu, EXC_STORE_PAGE_FAULT, vaddr);     \
-				return false;                                              \
-			}                                                                  \
-		} else {                                                                   \
-			paddr = vaddr;                                                     \
-		}                                                                          \
-                                                                                           \
-		bool ret = cpu_invalidate_instruction_cache(emu, vaddr);                   \
-                                                                                           \
-		if (!emu_physical_w##SIZE(emu, paddr, value)) {                            \
-			cpu_throw_exception(emu, EXC_STORE_ACCESS_FAULT, paddr);           \
-		}                                                                          \
-		return ret;                                                                \
+/* Misaligned accesses backed by RAM are done with a single host access, using the host pointer of each
+ * page they span, the other ones (faults and MMIO) are split into bytes to throw the exception of the first
+ * faulting byte
+ */
+static inline bool emu_misaligned_to_host(emulator_t* emu, guest_vaddr vaddr, size_t size, mmu_vg2pg_access_type_t access_type, uint8_t** first, uint8_t** second, size_t* first_len) {
+	size_t offset = vaddr & MMU_VG2PG_OFFSET_MASK;
+	*first_len = offset + size <= MMU_VG2PG_PAGE_SIZE ? size : MMU_VG2PG_PAGE_SIZE - offset;
+
+	*first = emu_virtual_to_host(emu, vaddr, access_type);
+	if (*first == NULL) {
+		return false;
+	}
+	if (*first_len == size) {
+		*second = NULL;
+		return true;
+	}
+	*second = emu_virtual_to_host(emu, vaddr + *first_len, access_type);
+	return *second != NULL;
+}
+
+#define EMU_RX_MISALIGNED(SIZE, TYPE)                                                                     \
+	static inline TYPE emu_r##SIZE##_misaligned(emulator_t* emu, guest_vaddr vaddr) {                 \
+		uint8_t *first, *second;                                                                  \
+		size_t first_len;                                                                         \
+		if (emu_misaligned_to_host(emu, vaddr, sizeof(TYPE), MMU_VG2PG_ACCESS_READ,               \
+					   &first, &second, &first_len)) {                                \
+			uint8_t bytes[sizeof(TYPE)];                                                      \
+			memcpy(bytes, first, first_len);                                                  \
+			if (second != NULL) {                                                             \
+				memcpy(bytes + first_len, second, sizeof(TYPE) - first_len);              \
+			}                                                                                 \
+			TYPE value;                                                                       \
+			memcpy(&value, bytes, sizeof(TYPE));                                              \
+			return le##SIZE##toh(value);                                                      \
+		}                                                                                         \
+                                                                                                          \
+		TYPE value = 0;                                                                           \
+		for (size_t i = 0; i < sizeof(TYPE) && !emu->cpu.exception_pending; i++) {                \
+			value |= (TYPE)emu_r8(emu, vaddr + i) << (i * 8);                                 \
+		}                                                                                         \
+		return value;                                                                             \
+	}
+
+#define EMU_RX(SIZE, TYPE)                                                                                 \
+	static TYPE emu_r##SIZE##_slow(emulator_t* emu, guest_vaddr vaddr) {                               \
+		size_t offset = vaddr & MMU_PG2H_OFFSET_MASK;                                              \
+		if ((offset & (sizeof(TYPE) - 1)) != 0) {                                                  \
+			return emu_r##SIZE##_misaligned(emu, vaddr);                                       \
+		}                                                                                          \
+		/* Read across page boudaries should be handled by the misaligned case */                  \
+		assert(offset + sizeof(TYPE) <= MMU_PG2H_PAGE_SIZE);                                       \
+                                                                                                           \
+		guest_paddr paddr;                                                                         \
+		if (emu_paging_should_translate(emu, true)) {                                              \
+			if (!mmu_vg2pg_translate(emu, MMU_VG2PG_ACCESS_READ,                               \
+						 vaddr, &paddr)) {                                         \
+				cpu_throw_exception(emu, EXC_LOAD_PAGE_FAULT, vaddr);                      \
+				return 0;                                                                  \
+			}                                                                                  \
+		} else {                                                                                   \
+			paddr = vaddr;                                                                     \
+		}                                                                                          \
+                                                                                                           \
+		TYPE value;                                                                                \
+		if (!emu_physical_r##SIZE(emu, paddr, &value)) {                                           \
+			cpu_throw_exception(emu, EXC_LOAD_ACCESS_FAULT, paddr);                            \
+			return 0;                                                                          \
+		} else {                                                                                   \
+			mmu_vg2h_tlb_fill(emu, MMU_VG2PG_ACCESS_READ, vaddr, paddr);                       \
+			return value;                                                                      \
+		}                                                                                          \
+	}                                                                                                  \
+                                                                                                           \
+	TYPE emu_r##SIZE(emulator_t* emu, guest_vaddr vaddr) {                                             \
+		size_t tlb_index = (vaddr >> MMU_VG2PG_PAGE_SHIFT) & emu->cpu.vg2h_tlb_mask;               \
+		mmu_vg2h_tlb_entry_t* tlb_entry = &emu->cpu.vg2h_data_tlb[tlb_index];                      \
+		if (tlb_entry->read_tag == MMU_VG2H_TLB_TAG(vaddr, sizeof(TYPE))) {                        \
+			return le##SIZE##toh(*(TYPE*)(vaddr + tlb_entry->host_addend));                    \
+		}                                                                                          \
+		return emu_r##SIZE##_slow(emu, vaddr);                                                     \
+	}
+
+#define EMU_WX_MISALIGNED(SIZE, TYPE)                                                                     \
+	static inline bool emu_w##SIZE##_misaligned(emulator_t* emu, guest_vaddr vaddr, TYPE value) {     \
+		uint8_t *first, *second;                                                                  \
+		size_t first_len;                                                                         \
+		if (emu_misaligned_to_host(emu, vaddr, sizeof(TYPE), MMU_VG2PG_ACCESS_WRITE,              \
+					   &first, &second, &first_len)) {                                \
+			bool ret = false;                                                                 \
+			for (guest_vaddr addr = vaddr & ~3; addr < vaddr + sizeof(TYPE); addr += 4) {     \
+				ret |= cpu_invalidate_instruction_cache(emu, addr);                       \
+			}                                                                                 \
+                                                                                                          \
+			uint8_t bytes[sizeof(TYPE)];                                                      \
+			value = htole##SIZE(value);                                                       \
+			memcpy(bytes, &value, sizeof(TYPE));                                              \
+			memcpy(first, bytes, first_len);                                                  \
+			if (second != NULL) {                                                             \
+				memcpy(second, bytes + first_len, sizeof(TYPE) - first_len);              \
+			}                                                                                 \
+			return ret;                                                                       \
+		}                                                                                         \
+                                                                                                          \
+		bool ret = false;                                                                         \
+		for (size_t i = 0; i < sizeof(TYPE) && !emu->cpu.exception_pending; i++) {               \
+			ret |= emu_w8(emu, vaddr + i, value & 0xff);                                      \
+			value >>= 8;                                                                      \
+		}                                                                                         \
+		return ret;                                                                               \
+	}
+
+#define EMU_WX(SIZE, TYPE)                                                                                  \
+	static bool emu_w##SIZE##_slow(emulator_t* emu, guest_vaddr vaddr, TYPE value) {                    \
+		size_t offset = vaddr & MMU_PG2H_OFFSET_MASK;                                               \
+		if ((offset & (sizeof(TYPE) - 1)) != 0) {                                                   \
+			return emu_w##SIZE##_misaligned(emu, vaddr, value);                                 \
+		}                                                                                           \
+		/* Write across page boudaries should be handled by the misaligned case */                  \
+		assert(offset + sizeof(TYPE) <= MMU_PG2H_PAGE_SIZE);                                        \
+                                                                                                            \
+		guest_paddr paddr;                                                                          \
+		if (emu_paging_should_translate(emu, true)) {                                               \
+			if (!mmu_vg2pg_translate(emu, MMU_VG2PG_ACCESS_WRITE,                               \
+						 vaddr, &paddr)) {                                          \
+				cpu_throw_exception(emu, EXC_STORE_PAGE_FAULT, vaddr);                      \
+				return false;                                                               \
+			}                                                                                   \
+		} else {                                                                                    \
+			paddr = vaddr;                                                                      \
+		}                                                                                           \
+                                                                                                            \
+		bool ret = cpu_invalidate_instruction_cache(emu, vaddr);                                    \
+                                                                                                            \
+		if (!emu_physical_w##SIZE(emu, paddr, value)) {                                             \
+			cpu_throw_exception(emu, EXC_STORE_ACCESS_FAULT, paddr);                            \
+		} else {                                                                                    \
+			mmu_vg2h_tlb_fill(emu, MMU_VG2PG_ACCESS_WRITE, vaddr, paddr);                       \
+		}                                                                                           \
+		return ret;                                                                                 \
+	}                                                                                                   \
+                                                                                                            \
+	bool emu_w##SIZE(emulator_t* emu, guest_vaddr vaddr, TYPE value) {                                  \
+		size_t tlb_index = (vaddr >> MMU_VG2PG_PAGE_SHIFT) & emu->cpu.vg2h_tlb_mask;                \
+		mmu_vg2h_tlb_entry_t* tlb_entry = &emu->cpu.vg2h_data_tlb[tlb_index];                       \
+		if (tlb_entry->write_tag == MMU_VG2H_TLB_TAG(vaddr, sizeof(TYPE))) {                        \
+			bool ret = cpu_invalidate_instruction_cache(emu, vaddr);                            \
+			*(TYPE*)(vaddr + tlb_entry->host_addend) = htole##SIZE(value);                      \
+			return ret;                                                                         \
+		}                                                                                           \
+		return emu_w##SIZE##_slow(emu, vaddr, value);                                               \
 	}
 
 // Reading or writing a 8 bit value misaligned shouldn't be possible
@@ -291,6 +647,19 @@ uint32_t emu_r32_ins(emulator_t* emu, guest_vaddr vaddr, uint8_t* exception_code
 
 	*exception_code = (uint8_t)-1;
 
+	// Sequential fetches hit the last fetched page, the ITLB is only indexed when crossing a page
+	guest_vaddr tag = MMU_VG2H_TLB_TAG(vaddr, 1);
+	if (emu->cpu.vg2h_fetch_page == tag) {
+		return le32toh(*(uint32_t*)(vaddr + emu->cpu.vg2h_fetch_page_addend));
+	}
+	size_t tlb_index = (vaddr >> MMU_VG2PG_PAGE_SHIFT) & emu->cpu.vg2h_tlb_mask;
+	mmu_vg2h_itlb_entry_t* tlb_entry = &emu->cpu.vg2h_fetch_itlb[tlb_index];
+	if (tlb_entry->tag == tag) {
+		emu->cpu.vg2h_fetch_page = tag;
+		emu->cpu.vg2h_fetch_page_addend = tlb_entry->host_addend;
+		return le32toh(*(uint32_t*)(vaddr + tlb_entry->host_addend));
+	}
+
 	guest_paddr paddr;
 	if (emu_paging_should_translate(emu, false)) {
 		if (!mmu_vg2pg_translate(emu, MMU_VG2PG_ACCESS_EXEC, vaddr, &paddr)) {
@@ -308,10 +677,50 @@ uint32_t emu_r32_ins(emulator_t* emu, guest_vaddr vaddr, uint8_t* exception_code
 		*exception_tval = paddr;
 		return 0;
 	} else {
+		mmu_vg2h_itlb_fill(emu, vaddr, paddr);
 		return value;
 	}
 }
 
+uint8_t* emu_virtual_to_host(emulator_t* emu, guest_vaddr vaddr, mmu_vg2pg_access_type_t access_type) {
+	bool data_access = access_type != MMU_VG2PG_ACCESS_EXEC;
+	size_t tlb_index = (vaddr >> MMU_VG2PG_PAGE_SHIFT) & emu->cpu.vg2h_tlb_mask;
+	if (data_access) {
+		mmu_vg2h_tlb_entry_t* tlb_entry = &emu->cpu.vg2h_data_tlb[tlb_index];
+		guest_vaddr tag = access_type == MMU_VG2PG_ACCESS_READ ? tlb_entry->read_tag : tlb_entry->write_tag;
+		if (tag == MMU_VG2H_TLB_TAG(vaddr, 1)) {
+			return (uint8_t*)(vaddr + tlb_entry->host_addend);
+		}
+	} else {
+		mmu_vg2h_itlb_entry_t* tlb_entry = &emu->cpu.vg2h_fetch_itlb[tlb_index];
+		if (tlb_entry->tag == MMU_VG2H_TLB_TAG(vaddr, 1)) {
+			return (uint8_t*)(vaddr + tlb_entry->host_addend);
+		}
+	}
+
+	guest_paddr paddr;
+	if (emu_paging_should_translate(emu, data_access)) {
+		if (!mmu_vg2pg_translate(emu, access_type, vaddr, &paddr)) {
+			return NULL;
+		}
+	} else {
+		paddr = vaddr;
+	}
+
+	mmu_pg2h_pte pte;
+	if (!mmu_pg2h_get_pte(emu, paddr, &pte) || (pte & MMU_PG2H_PTE_TYPE_MMIO)) {
+		return NULL;
+	}
+	if (data_access) {
+		mmu_vg2h_tlb_fill(emu, access_type, vaddr, paddr);
+	} else {
+		mmu_vg2h_itlb_fill(emu, vaddr, paddr);
+	}
+
+	uint8_t* pool = (uint8_t*)(pte & MMU_PG2H_PAGE_MASK);
+	return &pool[paddr & MMU_PG2H_OFFSET_MASK];
+}
+
 #define EMU_PHYSICAL_RX(SIZE, TYPE)                                                                                               \
 	bool emu_physical_r##SIZE(emulator_t* emu, guest_paddr paddr, TYPE* value) {                                              \
 		size_t offset = paddr & MMU_PG2H_OFFSET_MASK;                                                                     \
@@ -354,6 +763,7 @@ uint32_t emu_r32_ins(emulator_t* emu, guest_vaddr vaddr, uint8_t* exception_code
 		} else {                                                                                                        \
 			uint8_t* pool = (uint8_t*)(pte & MMU_PG2H_PAGE_MASK);                                                   \
 			TYPE* host_addr = (TYPE*)&pool[offset];                                                                 \
+			mmu_pg2h_prepare_write(emu, paddr, sizeof(TYPE));                                                       \
 			*host_addr = htole##SIZE(value);                                                                        \
 			return true;                                                                                            \
 		}                                                                                                               \
@@ -368,6 +778,157 @@ EMU_PHYSICAL_WX(32, uint32_t)
 EMU_PHYSICAL_WX(16, uint16_t)
 EMU_PHYSICAL_WX(8, uint8_t)
 
+uint8_t* emu_physical_host_span(emulator_t* emu, guest_paddr paddr, size_t* len) {
+	size_t requested_len = *len;
+	*len = 0;
+
+	size_t region_len;
+	uint8_t* region_addr = mmu_pg2h_get_ram(emu, paddr, &region_len);
+	if (region_addr != NULL) {
+		*len = region_len < requested_len ? region_len : requested_len;
+		return region_addr;
+	}
+
+	mmu_pg2h_pte pte;
+	if (!mmu_pg2h_get_pte(emu, paddr, &pte) || (pte & MMU_PG2H_PTE_TYPE_MMIO)) {
+		return NULL;
+	}
+	uint8_t* host_addr = (uint8_t*)(pte & MMU_PG2H_PAGE_MASK) + (paddr & MMU_PG2H_OFFSET_MASK);
+
+	size_t span_len = MMU_PG2H_PAGE_SIZE - (paddr & MMU_PG2H_OFFSET_MASK);
+	while (span_len < requested_len) {
+		if (!mmu_pg2h_get_pte(emu, paddr + span_len, &pte) || (pte & MMU_PG2H_PTE_TYPE_MMIO) ||
+		    (uint8_t*)(pte & MMU_PG2H_PAGE_MASK) != host_addr + span_len) {
+			break;
+		}
+		span_len += MMU_PG2H_PAGE_SIZE;
+	}
+
+	*len = span_len < requested_len ? span_len : requested_len;
+	return host_addr;
+}
+
+bool emu_physical_read(emulator_t* emu, guest_paddr paddr, void* buf, size_t len) {
+	uint8_t* buf_bytes = buf;
+	while (len > 0) {
+		size_t span_len = len;
+		uint8_t* host_addr = emu_physical_host_span(emu, paddr, &span_len);
+		if (host_addr != NULL) {
+			memcpy(buf_bytes, host_addr, span_len);
+		} else if (emu_physical_r8(emu, paddr, buf_bytes)) {
+			span_len = 1;
+		} else {
+			return false;
+		}
+
+		paddr += span_len;
+		buf_bytes += span_len;
+		len -= span_len;
+	}
+	return true;
+}
+
+bool emu_physical_write(emulator_t* emu, guest_paddr paddr, const void* buf, size_t len) {
+	const uint8_t* buf_bytes = buf;
+	while (len > 0) {
+		size_t span_len = len;
+		uint8_t* host_addr = emu_physical_host_span(emu, paddr, &span_len);
+		if (host_addr != NULL) {
+			mmu_pg2h_prepare_write(emu, paddr, span_len);
+			memcpy(host_addr, buf_bytes, span_len);
+		} else if (emu_physical_w8(emu, paddr, *buf_bytes)) {
+			span_len = 1;
+		} else {
+			return false;
+		}
+
+		paddr += span_len;
+		buf_bytes += span_len;
+		len -= span_len;
+	}
+	return true;
+}
+
+bool emu_physical_release(emulator_t* emu, guest_paddr paddr, size_t len, bool lazy) {
+	guest_paddr start = (paddr + MMU_PG2H_PAGE_SIZE - 1) & MMU_PG2H_PAGE_MASK;
+	guest_paddr end = (paddr + len) & MMU_PG2H_PAGE_MASK;
+	while (start < end) {
+		size_t span_len = end - start;
+		uint8_t* host_addr = emu_physical_host_span(emu, start, &span_len);
+		if (host_addr == NULL) {
+			return false;
+		}
+
+		mmu_pg2h_prepare_write(emu, start, span_len);
+		// NOTE : the deduplicated RAM is a shared mapping of a memfd, madvise wouldn't free its pages
+		if (!mmu_pg2h_dedup_release(emu, start, span_len)) {
+			// NOTE : MADV_FREE isn't supported by every kernel, the pages are then released immediately
+			if (!lazy || madvise(host_addr, span_len, MADV_FREE) != 0) {
+				madvise(host_addr, span_len, MADV_DONTNEED);
+			}
+		}
+		start += span_len;
+	}
+	return true;
+}
+
+bool emu_read(emulator_t* emu, guest_vaddr vaddr, void* buf, size_t len) {
+	uint8_t* buf_bytes = buf;
+	while (len > 0) {
+		size_t page_len = MMU_VG2PG_PAGE_SIZE - (vaddr & MMU_VG2PG_OFFSET_MASK);
+		if (page_len > len) {
+			page_len = len;
+		}
+
+		uint8_t* host_addr = emu_virtual_to_host(emu, vaddr, MMU_VG2PG_ACCESS_READ);
+		if (host_addr != NULL) {
+			memcpy(buf_bytes, host_addr, page_len);
+		} else {
+			// The page is either MMIO or faulting, the byte accessors handle both
+			page_len = 1;
+			*buf_bytes = emu_r8(emu, vaddr);
+			if (emu->cpu.exception_pending || !emu->running) {
+				return false;
+			}
+		}
+
+		vaddr += page_len;
+		buf_bytes += page_len;
+		len -= page_len;
+	}
+	return true;
+}
+
+bool emu_write(emulator_t* emu, guest_vaddr vaddr, const void* buf, size_t len) {
+	const uint8_t* buf_bytes = buf;
+	while (len > 0) {
+		size_t page_len = MMU_VG2PG_PAGE_SIZE - (vaddr & MMU_VG2PG_OFFSET_MASK);
+		if (page_len > len) {
+			page_len = len;
+		}
+
+		uint8_t* host_addr = emu_virtual_to_host(emu, vaddr, MMU_VG2PG_ACCESS_WRITE);
+		if (host_addr != NULL) {
+			for (guest_vaddr addr = vaddr & ~3; addr < vaddr + page_len; addr += 4) {
+				cpu_invalidate_instruction_cache(emu, addr);
+			}
+			memcpy(host_addr, buf_bytes, page_len);
+		} else {
+			// The page is either MMIO or faulting, the byte accessors handle both
+			page_len = 1;
+			emu_w8(emu, vaddr, *buf_bytes);
+			if (emu->cpu.exception_pending || !emu->running) {
+				return false;
+			}
+		}
+
+		vaddr += page_len;
+		buf_bytes += page_len;
+		len -= page_len;
+	}
+	return true;
+}
+
 void emu_ebreak(emulator_t* emu) {
 	if (emu->cpu.priv_mode != UO_MODE) {
 		cpu_throw_exception(emu, EXC_BREAKPOINT, 0);
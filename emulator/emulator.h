@@ -1,6 +1,7 @@
 #ifndef EMULATOR_H
 #define EMULATOR_H
 
+#include <signal.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -9,17 +10,72 @@
 #include "devices.h"
 #include "emulator_sdl.h"
 #include "isa.h"
+#include "mmu_paging_guest_to_guest.h"
 #include "mmu_paging_guest_to_host.h"
 
 // NOTE : forward declaration to deal with a cyclic dependency with device_plic.h
 typedef struct plic_t plic_t;
 
+/* emu_huge_pages_t : enum representing the kind of host pages backing a chunk of guest memory
+ */
+typedef enum emu_huge_pages_t {
+	EMU_HUGE_PAGES_NONE,
+	EMU_HUGE_PAGES_THP,
+	EMU_HUGE_PAGES_HUGETLB,
+} emu_huge_pages_t;
+
+/* emu_dedup_t : deduplication of the pages of guest memory with identical content
+ */
+typedef enum emu_dedup_t {
+	EMU_DEDUP_NONE,
+	EMU_DEDUP_KSM,  // the memory is marked as mergeable by the kernel samepage merging of the host
+	EMU_DEDUP_COW,  // the memory is shared copy-on-write by the passes of `emu_dedup_memory`
+} emu_dedup_t;
+
+/* EMU_HUGE_PAGE_SIZE : size of the huge pages used to back guest memory
+ */
+#define EMU_HUGE_PAGE_SIZE ((size_t)2 * 1024 * 1024)
+
+/* emu_cache_t : enumeration of the caches and TLBs sized independently
+ */
+typedef enum emu_cache_t {
+	EMU_CACHE_INSTRUCTION,  // instruction cache of the interpreter or of the dynarec
+	EMU_CACHE_PG2H_TLB,     // TLB of the guest physical to host page table
+	EMU_CACHE_VG2PG_TLB,    // TLB of the guest virtual to guest physical page table
+	EMU_CACHE_VG2H_TLB,     // unified TLBs and instruction fetch TLBs of every context
+	EMU_CACHE_COUNT,
+} emu_cache_t;
+
+/* EMU_CACHE_BITS_MIN, EMU_CACHE_BITS_MAX : bounds of the number of significant bits of a cache, the
+ *                                          adaptive sizing doesn't shrink a cache below EMU_CACHE_BITS_MIN
+ */
+#define EMU_CACHE_BITS_MIN 8
+#define EMU_CACHE_BITS_MAX 24
+
+/* EMU_CACHE_ADAPT_PERIOD : number of instructions retired between two adjustments of the size of the
+ *                          caches when the adaptive sizing is enabled
+ */
+#define EMU_CACHE_ADAPT_PERIOD (1ull << 24)
+
+/* EMU_CACHE_SHRINK_RATIO, EMU_CACHE_SHRINK_PERIODS : a cache is halved when it missed less than once per
+ *                                                    EMU_CACHE_SHRINK_RATIO entries during
+ *                                                    EMU_CACHE_SHRINK_PERIODS consecutive periods, it is
+ *                                                    doubled as soon as it missed more than once per entry
+ *                                                    during a single period
+ */
+#define EMU_CACHE_SHRINK_RATIO   64
+#define EMU_CACHE_SHRINK_PERIODS 4
+
 /* emulator_t : structure storing the emulator state
  */
 typedef struct emulator_t {
 	cpu_t cpu;
 	plic_t* plic;
 
+	mmu_pg2h_ram_region_t pg2h_ram_regions[MMU_PG2H_RAM_REGIONS_MAX];
+	size_t pg2h_ram_regions_len;
+	bool pg2h_dirty_log_enabled;
+	bool pg2h_dedup_enabled;
 	mmu_pg2h_pte pg2h_paging_table;
 	mmu_pg2h_tlb_entry_t* pg2h_tlb;
 	guest_paddr pg2h_tlb_mask;
@@ -28,8 +84,16 @@ typedef struct emulator_t {
 	size_t mmio_devices_len;
 	size_t mmio_devices_capacity;
 
-	uint32_t device_update_iter;
-	uint32_t device_update_iter_mask;
+	// NOTE : number of instructions to retire before the next update of the MMIO devices
+	uint64_t device_update_countdown;
+	uint64_t device_update_period;
+
+	// NOTE : the misses are counted by the slow path of every cache, see `emu_adapt_caches`
+	size_t cache_bits[EMU_CACHE_COUNT];
+	uint64_t cache_misses[EMU_CACHE_COUNT];
+	uint32_t cache_quiet_periods[EMU_CACHE_COUNT];
+	bool adaptive_caches;
+	uint64_t cache_period_retired;
 
 #ifdef RISCV_EMULATOR_SDL_SUPPORT
 	emu_sdl_data_t sdl_data;
@@ -37,17 +101,63 @@ typedef struct emulator_t {
 
 	bool running;
 	bool reboot;
+	volatile sig_atomic_t stop_requested;
 } emulator_t;
 
+/* EMU_CACHE_CLEAR_MADVISE_SIZE : size from which emu_clear_cache gives the pages of a cache back to the host
+ *                                instead of filling them with zeros
+ */
+#define EMU_CACHE_CLEAR_MADVISE_SIZE (16 << 20)
+
+/* emu_alloc_cache : allocate the zero-filled memory of a cache
+ *                   the memory is obtained from mmap, the host only backs the pages touched by the guest
+ *                   returns a pointer to the allocated memory
+ *     size_t size : size of the cache in bytes
+ */
+void* emu_alloc_cache(size_t size);
+
+/* emu_clear_cache : fill the memory of a cache allocated by emu_alloc_cache with zeros
+ *     void* cache : pointer to the memory of the cache
+ *     size_t size : size of the cache in bytes
+ */
+void emu_clear_cache(void* cache, size_t size);
+
+/* emu_free_cache : free the memory of a cache allocated by emu_alloc_cache
+ *     void* cache : pointer to the memory of the cache
+ *     size_t size : size of the cache in bytes
+ */
+void emu_free_cache(void* cache, size_t size);
+
+/* emu_instruction_cache_size : get the size in bytes of the instruction cache of an emulator, its entries
+ *                              depend on whether the dynarec is enabled
+ *     const emulator_t* emu : pointer to the emulator
+ */
+size_t emu_instruction_cache_size(const emulator_t* emu);
+
 /* emu_create : create an emulator
- *     emulator_t* emu               : pointer to the emulator_t struct to initialize
- *     guest_reg pc                  : initial value for the program counter
- *     size_t cache_bits             : number of significant bits for the different caches
- *     size_t device_update_period   : device update period in powers of 2
- *     bool dynarec_enabled          : enable dynamic recompilation
- *     bool user_only_mode           : enable user only mode
+ *     emulator_t* emu                            : pointer to the emulator_t struct to initialize
+ *     guest_reg pc                               : initial value for the program counter
+ *     const size_t cache_bits[EMU_CACHE_COUNT]   : initial number of significant bits for each cache
+ *     bool adaptive_caches                       : resize the caches depending on their miss rate
+ *     size_t device_update_period                : device update period in powers of 2 of retired instructions
+ *     bool dynarec_enabled                       : enable dynamic recompilation
+ *     bool user_only_mode                        : enable user only mode
+ */
+void emu_create(emulator_t* emu, guest_reg pc, const size_t cache_bits[EMU_CACHE_COUNT], bool adaptive_caches,
+		size_t device_update_period, bool dynarec_enabled, bool user_only_mode);
+
+/* emu_resize_cache : change the number of entries of a cache, all its entries are dropped
+ *     emulator_t* emu   : pointer to the emulator
+ *     emu_cache_t cache : cache to resize
+ *     size_t bits       : new number of significant bits of the cache, at most EMU_CACHE_BITS_MAX
  */
-void emu_create(emulator_t* emu, guest_reg pc, size_t cache_bits, size_t device_update_period, bool dynarec_enabled, bool user_only_mode);
+void emu_resize_cache(emulator_t* emu, emu_cache_t cache, size_t bits);
+
+/* emu_adapt_caches : double the caches missing too often and halve the caches missing rarely, the misses
+ *                    counted since the previous call are reset
+ *     emulator_t* emu : pointer to the emulator
+ */
+void emu_adapt_caches(emulator_t* emu);
 
 /* emu_destroy : destroy an emulator and free its associated ressources
  *     emulator_t* emu : pointer to the emulator_t struct to destroy
@@ -57,11 +167,20 @@ void emu_destroy(emulator_t* emu);
 /* emu_map_memory : map a chunk of mmaped memory to the guest
  *                  returns true if the memory was successfully allocated and mapped
  *                  returns false otherwise
- *     emulator_t* emu  : pointer to the emulator
- *     guest_paddr base : base guest physical address for the newly allocated memory
- *     size_t size      : size of the memory chunk to mmap
+ *     emulator_t* emu             : pointer to the emulator
+ *     guest_paddr base            : base guest physical address for the newly allocated memory
+ *     size_t size                 : size of the memory chunk to mmap
+ *     emu_huge_pages_t huge_pages : kind of host pages backing the memory, it falls back to transparent
+ *                                   huge pages if hugetlbfs pages can't be allocated
+ *     emu_dedup_t dedup           : deduplication of the memory, huge pages are ignored by EMU_DEDUP_COW
  */
-bool emu_map_memory(emulator_t* emu, guest_paddr base, size_t size);
+bool emu_map_memory(emulator_t* emu, guest_paddr base, size_t size, emu_huge_pages_t huge_pages, emu_dedup_t dedup);
+
+/* emu_dedup_memory : run a deduplication pass over the guest memory mapped with EMU_DEDUP_COW
+ *                    returns the number of host pages freed by the pass
+ *     emulator_t* emu : pointer to the emulator
+ */
+size_t emu_dedup_memory(emulator_t* emu);
 
 /* emu_add_mmio_device : map and add a MMIO device to the guest
  *                       returns true if the device was successfully attached
@@ -78,6 +197,51 @@ bool emu_add_mmio_device(emulator_t* emu, guest_paddr base, size_t size, const d
  */
 void emu_update_mmio_devices(emulator_t* emu);
 
+/* EMU_IDLE_MAX_WAIT_NS : maximum time in nanoseconds the emulator waits for an event while the CPU is
+ *                        idle, it bounds the latency of the devices without an idle handler
+ */
+#define EMU_IDLE_MAX_WAIT_NS 100000000  // 100ms
+
+/* emu_idle : wait until a device might have an event for the CPU and update the MMIO devices
+ *            this is used when the CPU is idle to avoid burning host CPU time
+ *     emulator_t* emu     : pointer to the emulator
+ *     uint64_t max_wait_ns : maximum time in nanoseconds to wait
+ */
+void emu_idle(emulator_t* emu, uint64_t max_wait_ns);
+
+/* emu_exit_reason_t : reason why `emu_run` returned
+ */
+typedef enum emu_exit_reason_t {
+	EMU_EXIT_HALTED,          // the guest stopped the emulator (e.g. poweroff, reboot or uncaught exception)
+	EMU_EXIT_BUDGET,          // the instruction budget was exhausted
+	EMU_EXIT_TIMEOUT,         // the host time budget expired
+	EMU_EXIT_STOP_REQUESTED,  // `emu_request_stop` was called
+} emu_exit_reason_t;
+
+/* EMU_RUN_UNLIMITED : budget value used to disable a limit of `emu_run`
+ */
+#define EMU_RUN_UNLIMITED UINT64_MAX
+
+/* EMU_RUN_TIME_CHECK_PERIOD : number of blocks executed by `emu_run` between two checks of the host time
+ *                             must be a power of 2
+ */
+#define EMU_RUN_TIME_CHECK_PERIOD 1024
+
+/* emu_run : execute guest code until the guest halts, a budget is exhausted or a stop is requested
+ *           with the dynarec, the last block is always run up to its end and may thus exceed the instruction budget
+ *           returns the reason why the execution stopped
+ *     emulator_t* emu             : pointer to the emulator
+ *     uint64_t max_instructions   : maximum number of instructions to execute, or EMU_RUN_UNLIMITED
+ *     uint64_t max_host_time_ns   : maximum host time in nanoseconds to run for, or EMU_RUN_UNLIMITED
+ */
+emu_exit_reason_t emu_run(emulator_t* emu, uint64_t max_instructions, uint64_t max_host_time_ns);
+
+/* emu_request_stop : ask a running `emu_run` to return as soon as possible
+ *                    it is async-signal-safe and may be called from a signal handler
+ *     emulator_t* emu : pointer to the emulator
+ */
+void emu_request_stop(emulator_t* emu);
+
 /* emu_wx : write a x bits value to the guest memory using a virtual address
  *          returns true if a cache entry was invalidated in the process
  *          returns false otherwise
@@ -112,6 +276,17 @@ uint64_t emu_r64(emulator_t* emu, guest_vaddr vaddr);
  */
 uint32_t emu_r32_ins(emulator_t* emu, guest_vaddr vaddr, uint8_t* exception_code, guest_reg* exception_tval);
 
+/* emu_virtual_to_host : translate a guest virtual address to a pointer to the host memory backing it
+ *                       no exception is thrown, the caller is expected to fallback to the regular
+ *                       accessors when the translation fails
+ *                       returns a pointer to the host memory if the address is backed by RAM and the access is allowed
+ *                       returns NULL otherwise
+ *     emulator_t* emu                     : pointer to the emulator
+ *     guest_vaddr vaddr                   : guest virtual address to translate
+ *     mmu_vg2pg_access_type_t access_type : requested access type
+ */
+uint8_t* emu_virtual_to_host(emulator_t* emu, guest_vaddr vaddr, mmu_vg2pg_access_type_t access_type);
+
 /* emu_physical_rx : read a x bits value from the guest memory using a physical address
  *                   returns true if the value was read
  *     emulator_t* emu   : pointer to the emulator
@@ -134,6 +309,69 @@ bool emu_physical_w16(emulator_t* emu, guest_paddr paddr, uint16_t value);
 bool emu_physical_w32(emulator_t* emu, guest_paddr paddr, uint32_t value);
 bool emu_physical_w64(emulator_t* emu, guest_paddr paddr, uint64_t value);
 
+/* emu_physical_host_span : get a pointer to the host memory backing a span of guest physical memory
+ *                          the span stops at the first page which isn't backed by RAM or isn't contiguous on the host
+ *                          callers writing to the span must call mmu_pg2h_prepare_write beforehand
+ *                          returns a pointer to the host memory if the first page is backed by RAM
+ *                          returns NULL otherwise
+ *     emulator_t* emu   : pointer to the emulator
+ *     guest_paddr paddr : guest physical address of the beginning of the span
+ *     size_t* len       : requested length of the span, set to the length available on the host
+ */
+uint8_t* emu_physical_host_span(emulator_t* emu, guest_paddr paddr, size_t* len);
+
+/* emu_physical_read : read a buffer from the guest memory using a physical address
+ *                     the spans backed by RAM are copied at once, MMIO is read byte per byte
+ *                     returns true if the whole buffer was read
+ *     emulator_t* emu   : pointer to the emulator
+ *     guest_paddr paddr : guest physical address to read from
+ *     void* buf         : buffer to fill
+ *     size_t len        : number of bytes to read
+ */
+bool emu_physical_read(emulator_t* emu, guest_paddr paddr, void* buf, size_t len);
+
+/* emu_physical_write : write a buffer to the guest memory using a physical address
+ *                      the spans backed by RAM are copied at once, MMIO is written byte per byte
+ *                      returns true if the whole buffer was written
+ *     emulator_t* emu   : pointer to the emulator
+ *     guest_paddr paddr : guest physical address to write to
+ *     const void* buf   : buffer to write
+ *     size_t len        : number of bytes to write
+ */
+bool emu_physical_write(emulator_t* emu, guest_paddr paddr, const void* buf, size_t len);
+
+/* emu_physical_release : give the host memory backing a range of guest physical RAM back to the host
+ *                        only the pages fully within the range are released, their content is undefined afterwards
+ *                        returns true if the whole range is backed by RAM
+ *     emulator_t* emu   : pointer to the emulator
+ *     guest_paddr paddr : guest physical address of the start of the range
+ *     size_t len        : length of the range
+ *     bool lazy         : let the host reclaim the pages only under memory pressure (MADV_FREE) instead of
+ *                         immediately (MADV_DONTNEED)
+ */
+bool emu_physical_release(emulator_t* emu, guest_paddr paddr, size_t len, bool lazy);
+
+/* emu_read : read a buffer from the guest memory using a virtual address
+ *            each page is translated once, exceptions are thrown as with `emu_r8`
+ *            returns true if the whole buffer was read
+ *     emulator_t* emu   : pointer to the emulator
+ *     guest_vaddr vaddr : guest virtual address to read from
+ *     void* buf         : buffer to fill
+ *     size_t len        : number of bytes to read
+ */
+bool emu_read(emulator_t* emu, guest_vaddr vaddr, void* buf, size_t len);
+
+/* emu_write : write a buffer to the guest memory using a virtual address
+ *             each page is translated once, exceptions are thrown and the instruction cache is invalidated
+ *             as with `emu_w8`
+ *             returns true if the whole buffer was written
+ *     emulator_t* emu   : pointer to the emulator
+ *     guest_vaddr vaddr : guest virtual address to write to
+ *     const void* buf   : buffer to write
+ *     size_t len        : number of bytes to write
+ */
+bool emu_write(emulator_t* emu, guest_vaddr vaddr, const void* buf, size_t len);
+
 /* emu_ebreak : handle the ebreak instruction
  *     emulator_t* emu : pointer to the emulator
  */
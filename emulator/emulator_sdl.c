@@ -1,6 +1,7 @@
 #ifdef RISCV_EMULATOR_SDL_SUPPORT
 
 #include <assert.h>
+#include <endian.h>
 #include <stdint.h>
 #include <time.h>
 
@@ -62,8 +63,9 @@ void emu_sdl_draw(emulator_t* emu, guest_paddr addr) {
 	}
 
 	const size_t frame_size = emu->sdl_data.width * emu->sdl_data.height;
-	for (size_t i = 0; i < frame_size && !emu->cpu.exception_pending; i++) {
-		emu_physical_r32(emu, addr + (i * sizeof(uint32_t)), &emu->sdl_data.framebuffer[i]);
+	emu_physical_read(emu, addr, emu->sdl_data.framebuffer, frame_size * sizeof(uint32_t));
+	for (size_t i = 0; i < frame_size; i++) {
+		emu->sdl_data.framebuffer[i] = le32toh(emu->sdl_data.framebuffer[i]);
 	}
 
 	int ret = SDL_UpdateTexture(emu->sdl_data.texture, NULL, emu->sdl_data.framebuffer, emu->sdl_data.width * sizeof(uint32_t));
@@ -1,7 +1,9 @@
 #ifndef ISA_H
 #define ISA_H
 
+#include <assert.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include <rv64_isa.h>
@@ -22,6 +24,8 @@ typedef enum __attribute__((packed)) ins_type_t {
 } ins_type_t;
 
 /* ins_t : structure representing a decoded RISC-V instruction
+ * NOTE : every immediate of RV64I fits in 32 bits once sign extended, the handlers extend it back to
+ *        64 bits when they load it, this keeps the instruction cache entries small
  */
 typedef struct ins_t {
 	ins_type_t type;
@@ -32,18 +36,34 @@ typedef struct ins_t {
 	reg_t rs1;
 	reg_t rs2;
 
-	int64_t imm;
+	int32_t imm;
 } ins_t;
 
+static_assert(sizeof(ins_t) == 12, "Decoded instructions are expected to be packed on 12 bytes");
+
+// NOTE : forward declaration to deal with a cyclic dependency with emulator.h
+typedef struct emulator_t emulator_t;
+
+/* cpu_handler_t : function pointer to the handler executing a single decoded instruction
+ */
+typedef void (*cpu_handler_t)(emulator_t* emu, const ins_t* instruction);
+
 /* cached_ins_t : structure representing a decoded RISC-V instruction cached in
  *                the CPU instruction cache
  */
 typedef struct cached_ins_t {
 	guest_vaddr tag;
+	cpu_handler_t handler;
 	ins_t decoded_instruction;
+	// NOTE : the next instruction when `handler` is a superinstruction, its type is INS_TYPE_INVALID otherwise
+	ins_t fused_instruction;
 } cached_ins_t;
 
-/* BREAK_IF_EXCEPTION_PENDING : macro used to quickly break out of the cpu_execute switch
+static_assert(offsetof(cached_ins_t, fused_instruction) ==
+		      offsetof(cached_ins_t, decoded_instruction) + sizeof(ins_t),
+	      "Superinstructions expect both instructions to be contiguous");
+
+/* BREAK_IF_EXCEPTION_PENDING : macro used to quickly break out of the expression of an instruction
  *                              when an exception is pending
  */
 #define BREAK_IF_EXCEPTION_PENDING()  \
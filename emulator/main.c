@@ -17,6 +17,9 @@
 #define DEFAULT_RAM_SIZE             0x2000
 #define DEFAULT_CACHE_BITS           16
 #define DEFAULT_DEVICE_UPDATE_PERIOD 18
+#define DEDUP_PERIOD_NS              1000000000ull
+// NOTE : number of bits of a cache without a specific option, the value of `--cache-bits` is used instead
+#define CACHE_BITS_UNSET             ((size_t)-1)
 
 static int usage(const char* argv0) {
 	fprintf(stderr,
@@ -31,19 +34,39 @@ static int usage(const char* argv0) {
 		"    --rom-size 0x[ROM SIZE]  : Size of the ROM (defaut 0x%08x)\n"
 		"    --ram-base 0x[RAM BASE]  : Base address of the RAM (default 0x%08x)\n"
 		"    --ram-size 0x[RAM SIZE]  : Size of the RAM (default 0x%08x)\n"
+		"    --huge-pages [MODE]      : Back the RAM with huge pages, MODE is \"none\" (default), \"thp\" for\n"
+		"                               transparent huge pages or \"hugetlb\" for hugetlbfs pages\n"
+		"    --dedup [MODE]           : Deduplicate the pages of the RAM with identical content, MODE is \"none\"\n"
+		"                               (default), \"ksm\" to let the host kernel merge them or \"cow\" to share\n"
+		"                               them copy-on-write within the emulator every second\n"
 		"    --user-only              : Keep the emulated CPU in U-mode and expose emulator calls through ecall\n"
 		"                               (as used by the provided `DOOM` port)\n"
 		"    --virt [HDD IMAGE]       : Create a QEMU \"virt\" style machine following the device tree described\n"
 		"                               in `linux/emulator.dts`\n"
+		"    --virt-backend [MODE]    : Access to the HDD image of the \"virt\" machine, MODE is \"pread\" (default)\n"
+		"                               for pread(2) and pwrite(2) or \"mmap\" to map the image in memory\n"
+#ifdef RISCV_EMULATOR_IO_URING_SUPPORT
+		"                               or \"io_uring\" and \"io_uring-direct\" (O_DIRECT) to transfer the data\n"
+		"                               asynchronously while the guest keeps running\n"
+#endif
+		"    --balloon-size 0x[SIZE]  : Amount of RAM requested back by the balloon of the \"virt\" machine (default 0)\n"
 #ifdef RISCV_EMULATOR_DYNAREC_X86_64_SUPPORT
 		"    --dynarec                : Enable dynamic recompilation to x86-64 assembly\n"
 #endif
 		"    --cache-bits [BITS]      : Number of significant bits for the different caches (default %d)\n"
-		"    --dev-update-period [T]  : Device update period in powers of 2 (default %d)\n",
+		"    --icache-bits [BITS]     : Number of significant bits for the instruction cache (default --cache-bits)\n"
+		"    --pg2h-tlb-bits [BITS]   : Number of significant bits for the guest physical to host TLB\n"
+		"                               (default --cache-bits)\n"
+		"    --vg2pg-tlb-bits [BITS]  : Number of significant bits for the guest virtual to guest physical TLB\n"
+		"                               (default --cache-bits)\n"
+		"    --vg2h-tlb-bits [BITS]   : Number of significant bits for the guest virtual to host TLBs of each\n"
+		"                               context (default --cache-bits)\n"
+		"    --adaptive-caches        : Grow or shrink the caches between %d and %d bits depending on their miss rate\n"
+		"    --dev-update-period [T]  : Device update period in powers of 2 of instructions (default %d)\n",
 		argv0, argv0,
 		DEFAULT_ROM_BASE, DEFAULT_ROM_SIZE,
 		DEFAULT_RAM_BASE, DEFAULT_RAM_SIZE,
-		DEFAULT_CACHE_BITS, DEFAULT_DEVICE_UPDATE_PERIOD);
+		DEFAULT_CACHE_BITS, EMU_CACHE_BITS_MIN, EMU_CACHE_BITS_MAX, DEFAULT_DEVICE_UPDATE_PERIOD);
 	return 1;
 }
 
@@ -68,12 +91,19 @@ static int main_simple(const char* hex_input_filename, const char* emu_output_fi
 		return 1;
 	}
 
+	const size_t cache_bits[EMU_CACHE_COUNT] = {
+		[EMU_CACHE_INSTRUCTION] = DEFAULT_CACHE_BITS,
+		[EMU_CACHE_PG2H_TLB] = DEFAULT_CACHE_BITS,
+		[EMU_CACHE_VG2PG_TLB] = DEFAULT_CACHE_BITS,
+		[EMU_CACHE_VG2H_TLB] = DEFAULT_CACHE_BITS,
+	};
+
 	emulator_t emu;
 	emu_create(&emu, SIMPLE_ROM_BASE,
-		   DEFAULT_CACHE_BITS, DEFAULT_DEVICE_UPDATE_PERIOD,
+		   cache_bits, false, DEFAULT_DEVICE_UPDATE_PERIOD,
 		   SIMPLE_DYNAREC_ENABLED, true);
-	bool map_ret = emu_map_memory(&emu, SIMPLE_ROM_BASE, SIMPLE_ROM_SIZE);
-	map_ret &= emu_map_memory(&emu, DEFAULT_RAM_BASE, DEFAULT_RAM_SIZE);
+	bool map_ret = emu_map_memory(&emu, SIMPLE_ROM_BASE, SIMPLE_ROM_SIZE, EMU_HUGE_PAGES_NONE, EMU_DEDUP_NONE);
+	map_ret &= emu_map_memory(&emu, DEFAULT_RAM_BASE, DEFAULT_RAM_SIZE, EMU_HUGE_PAGES_NONE, EMU_DEDUP_NONE);
 	assert(map_ret);
 
 	guest_paddr max_rom_code_addr = SIMPLE_ROM_BASE;
@@ -93,8 +123,9 @@ static int main_simple(const char* hex_input_filename, const char* emu_output_fi
 	fclose(input_file);
 
 	emu.cpu.regs[2] = SIMPLE_ROM_SIZE;  // sp
-	while (emu.cpu.pc < max_rom_code_addr && emu.running) {
-		cpu_execute(&emu);
+	// The execution is stepped one instruction at a time to stop at the end of the ROM code
+	while (emu.cpu.pc < max_rom_code_addr &&
+	       emu_run(&emu, 1, EMU_RUN_UNLIMITED) == EMU_EXIT_BUDGET) {
 	}
 
 	FILE* output_file;
@@ -135,9 +166,16 @@ static int main_advanced(int argc, char** argv) {
 
 	const char *rom_file = NULL, *hdd_file = NULL;
 	guest_paddr rom_base = DEFAULT_ROM_BASE, ram_base = DEFAULT_RAM_BASE;
-	size_t rom_size = DEFAULT_ROM_SIZE, ram_size = DEFAULT_RAM_SIZE;
+	size_t rom_size = DEFAULT_ROM_SIZE, ram_size = DEFAULT_RAM_SIZE, balloon_size = 0;
 	size_t cache_bits = DEFAULT_CACHE_BITS, device_update_period = DEFAULT_DEVICE_UPDATE_PERIOD;
-	bool dynarec_enabled = false, user_only_mode = false;
+	size_t cache_bits_by_cache[EMU_CACHE_COUNT];
+	for (emu_cache_t cache = 0; cache < EMU_CACHE_COUNT; cache++) {
+		cache_bits_by_cache[cache] = CACHE_BITS_UNSET;
+	}
+	bool dynarec_enabled = false, user_only_mode = false, adaptive_caches = false;
+	emu_huge_pages_t ram_huge_pages = EMU_HUGE_PAGES_NONE;
+	emu_dedup_t ram_dedup = EMU_DEDUP_NONE;
+	virtio_block_backend_t hdd_backend = VIRTIO_BLOCK_BACKEND_PREAD;
 
 	while (argc_iter < argc) {
 		if (strcmp(argv[argc_iter], "--advanced") == 0) {
@@ -159,7 +197,12 @@ static int main_advanced(int argc, char** argv) {
 		PARSE_NUM_ARG("--ram-base", &ram_base)
 		PARSE_NUM_ARG("--ram-size", &ram_size)
 		PARSE_NUM_ARG("--cache-bits", &cache_bits)
+		PARSE_NUM_ARG("--icache-bits", &cache_bits_by_cache[EMU_CACHE_INSTRUCTION])
+		PARSE_NUM_ARG("--pg2h-tlb-bits", &cache_bits_by_cache[EMU_CACHE_PG2H_TLB])
+		PARSE_NUM_ARG("--vg2pg-tlb-bits", &cache_bits_by_cache[EMU_CACHE_VG2PG_TLB])
+		PARSE_NUM_ARG("--vg2h-tlb-bits", &cache_bits_by_cache[EMU_CACHE_VG2H_TLB])
 		PARSE_NUM_ARG("--dev-update-period", &device_update_period)
+		PARSE_NUM_ARG("--balloon-size", &balloon_size)
 #undef PARSE_NUM_ARG
 #ifdef RISCV_EMULATOR_DYNAREC_X86_64_SUPPORT
 		else if (strcmp(argv[argc_iter], "--dynarec") == 0) {
@@ -167,10 +210,63 @@ static int main_advanced(int argc, char** argv) {
 			dynarec_enabled = true;
 		}
 #endif
+		else if (strcmp(argv[argc_iter], "--adaptive-caches") == 0) {
+			argc_iter++;
+			adaptive_caches = true;
+		}
 		else if (strcmp(argv[argc_iter], "--user-only") == 0) {
 			argc_iter++;
 			user_only_mode = true;
 		}
+		else if (strcmp(argv[argc_iter], "--huge-pages") == 0) {
+			argc_iter++;
+			if (argc_iter >= argc) {
+				return usage(argv[0]);
+			} else if (strcmp(argv[argc_iter], "none") == 0) {
+				ram_huge_pages = EMU_HUGE_PAGES_NONE;
+			} else if (strcmp(argv[argc_iter], "thp") == 0) {
+				ram_huge_pages = EMU_HUGE_PAGES_THP;
+			} else if (strcmp(argv[argc_iter], "hugetlb") == 0) {
+				ram_huge_pages = EMU_HUGE_PAGES_HUGETLB;
+			} else {
+				return usage(argv[0]);
+			}
+			argc_iter++;
+		}
+		else if (strcmp(argv[argc_iter], "--dedup") == 0) {
+			argc_iter++;
+			if (argc_iter >= argc) {
+				return usage(argv[0]);
+			} else if (strcmp(argv[argc_iter], "none") == 0) {
+				ram_dedup = EMU_DEDUP_NONE;
+			} else if (strcmp(argv[argc_iter], "ksm") == 0) {
+				ram_dedup = EMU_DEDUP_KSM;
+			} else if (strcmp(argv[argc_iter], "cow") == 0) {
+				ram_dedup = EMU_DEDUP_COW;
+			} else {
+				return usage(argv[0]);
+			}
+			argc_iter++;
+		}
+		else if (strcmp(argv[argc_iter], "--virt-backend") == 0) {
+			argc_iter++;
+			if (argc_iter >= argc) {
+				return usage(argv[0]);
+			} else if (strcmp(argv[argc_iter], "pread") == 0) {
+				hdd_backend = VIRTIO_BLOCK_BACKEND_PREAD;
+			} else if (strcmp(argv[argc_iter], "mmap") == 0) {
+				hdd_backend = VIRTIO_BLOCK_BACKEND_MMAP;
+#ifdef RISCV_EMULATOR_IO_URING_SUPPORT
+			} else if (strcmp(argv[argc_iter], "io_uring") == 0) {
+				hdd_backend = VIRTIO_BLOCK_BACKEND_IO_URING;
+			} else if (strcmp(argv[argc_iter], "io_uring-direct") == 0) {
+				hdd_backend = VIRTIO_BLOCK_BACKEND_IO_URING_DIRECT;
+#endif
+			} else {
+				return usage(argv[0]);
+			}
+			argc_iter++;
+		}
 		else if (strcmp(argv[argc_iter], "--virt") == 0) {
 			argc_iter++;
 			hdd_file = argv[argc_iter++];
@@ -200,10 +296,16 @@ static int main_advanced(int argc, char** argv) {
 		return 1;
 	}
 
+	for (emu_cache_t cache = 0; cache < EMU_CACHE_COUNT; cache++) {
+		if (cache_bits_by_cache[cache] == CACHE_BITS_UNSET) {
+			cache_bits_by_cache[cache] = cache_bits;
+		}
+	}
+
 	emulator_t emu;
-	emu_create(&emu, rom_base, cache_bits, device_update_period, dynarec_enabled, user_only_mode);
-	if (!emu_map_memory(&emu, rom_base, rom_size) ||
-	    !emu_map_memory(&emu, ram_base, ram_size)) {
+	emu_create(&emu, rom_base, cache_bits_by_cache, adaptive_caches, device_update_period, dynarec_enabled, user_only_mode);
+	if (!emu_map_memory(&emu, rom_base, rom_size, EMU_HUGE_PAGES_NONE, EMU_DEDUP_NONE) ||
+	    !emu_map_memory(&emu, ram_base, ram_size, ram_huge_pages, ram_dedup)) {
 		fprintf(stderr,
 			"Unable to map the emulated memory\n"
 			"Make sure it's properly aligned to page boundaries and is using cannonical addresses\n");
@@ -223,20 +325,22 @@ static int main_advanced(int argc, char** argv) {
 	}
 	fclose(input_file);
 
-	for (size_t i = 0; i < file_size; i++) {
-		emu_w8(&emu, rom_base + i, rom_content[i]);
-	}
+	emu_write(&emu, rom_base, rom_content, file_size);
 	free(rom_content);
 
 	if (hdd_file != NULL &&
-	    !devices_create_virt_machine(&emu, hdd_file)) {
+	    !devices_create_virt_machine(&emu, hdd_file, hdd_backend, balloon_size / MMU_PG2H_PAGE_SIZE)) {
 		fprintf(stderr, "Unable to create a \"virt\" machine\n");
 		emu_destroy(&emu);
 		return 1;
 	}
 
-	while (emu.running) {
-		cpu_execute(&emu);
+	if (ram_dedup == EMU_DEDUP_COW) {
+		while (emu_run(&emu, EMU_RUN_UNLIMITED, DEDUP_PERIOD_NS) == EMU_EXIT_TIMEOUT) {
+			emu_dedup_memory(&emu);
+		}
+	} else {
+		emu_run(&emu, EMU_RUN_UNLIMITED, EMU_RUN_UNLIMITED);
 	}
 
 	bool reboot = emu.reboot;
@@ -4,11 +4,33 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "dynarec_x86_64.h"
 #include "emulator.h"
 #include "isa.h"
 #include "mmu_paging_guest_to_guest.h"
 #include "mmu_paging_guest_to_host.h"
 
+static mmu_vg2pg_pte* mmu_vg2pg_host_table(emulator_t* emu, guest_paddr table) {
+	mmu_pg2h_pte pte;
+	if (!mmu_pg2h_get_pte(emu, table, &pte) || (pte & MMU_PG2H_PTE_TYPE_MMIO)) {
+		return NULL;
+	}
+	return (mmu_vg2pg_pte*)(pte & MMU_PG2H_PAGE_MASK);
+}
+
+static inline bool mmu_vg2pg_read_pte(emulator_t* emu, guest_paddr table, mmu_vg2pg_pte* host_table, size_t index, mmu_vg2pg_pte* pte) {
+	if (host_table != NULL) {
+		*pte = le64toh(host_table[index]);
+		return true;
+	}
+	return emu_physical_r64(emu, table + index * sizeof(mmu_vg2pg_pte), pte);
+}
+
+static void mmu_vg2pg_flush_pwc(emulator_t* emu) {
+	// NOTE : the entries are only cleared on the next walk, when it notices the root table changed
+	emu->cpu.vg2pg_pwc_root = (guest_paddr)-1;
+}
+
 static bool mmu_vg2pg_walk(emulator_t* emu, guest_vaddr vaddr, mmu_vg2pg_pte* pte_out, ssize_t* levels_remaining, guest_paddr* pte_paddr) {
 	if (MMU_SV39_VPN_TOP(vaddr) != MMU_SV39_VPN_TOPP &&
 	    MMU_SV39_VPN_TOP(vaddr) != MMU_SV39_VPN_TOPN) {
@@ -27,9 +49,34 @@ static bool mmu_vg2pg_walk(emulator_t* emu, guest_vaddr vaddr, mmu_vg2pg_pte* pt
 	ssize_t i = 3 - 1;
 	mmu_vg2pg_pte pte;
 
+	if (a != emu->cpu.vg2pg_pwc_root) {
+		for (size_t level = 0; level < 2; level++) {
+			for (size_t j = 0; j < MMU_VG2PG_PWC_SIZE; j++) {
+				emu->cpu.vg2pg_pwc[level][j].tag = (guest_vaddr)-1;
+			}
+		}
+		emu->cpu.vg2pg_pwc_root = a;
+		emu->cpu.vg2pg_pwc_root_host = mmu_vg2pg_host_table(emu, a);
+	}
+	mmu_vg2pg_pte* host_a = emu->cpu.vg2pg_pwc_root_host;
+
+	/* The page-walk cache stores the non-leaf PTEs, we start the walk from the deepest table of the
+	 * virtual address it knows about
+	 */
+	guest_vaddr vpn_prefix[] = {vaddr >> 21 & 0x3ffff, vaddr >> 30 & 0x1ff};
+	for (ssize_t level = 0; level < 2; level++) {
+		mmu_vg2pg_pwc_entry_t* pwc_entry = &emu->cpu.vg2pg_pwc[level][vpn_prefix[level] & (MMU_VG2PG_PWC_SIZE - 1)];
+		if (pwc_entry->tag == vpn_prefix[level]) {
+			a = pwc_entry->table;
+			host_a = pwc_entry->host_table;
+			i = level;
+			break;
+		}
+	}
+
 	while (1) {
 		// 2. Let pte be the value of the PTE at address a+va.vpn[i]*PTESIZE.
-		if (!emu_physical_r64(emu, a + vpn[i] * sizeof(mmu_vg2pg_pte), &pte)) {
+		if (!mmu_vg2pg_read_pte(emu, a, host_a, vpn[i], &pte)) {
 			return false;
 		}
 
@@ -39,8 +86,16 @@ static bool mmu_vg2pg_walk(emulator_t* emu, guest_vaddr vaddr, mmu_vg2pg_pte* pt
 		 */
 		if (!(pte & MMU_VG2PG_PTE_VALID) ||
 		    (!(pte & MMU_VG2PG_PTE_READ) && (pte & MMU_VG2PG_PTE_WRITE)) ||
-		    (pte & MMU_VG2PG_PTE_PBMT) != 0 ||
-		    (pte & MMU_VG2PG_PTE_N) != 0) {
+		    (pte & MMU_VG2PG_PTE_PBMT) != 0) {
+			return false;
+		}
+
+		/* NOTE : Svnapot only defines 64 KiB ranges mapped by leaf PTEs of the last level, N is reserved in
+		 *        non-leaf PTEs and the other sizes are reserved encodings
+		 */
+		if ((pte & MMU_VG2PG_PTE_N) &&
+		    (i != 0 || !((pte & MMU_VG2PG_PTE_READ) || (pte & MMU_VG2PG_PTE_EXEC)) ||
+		     (MMU_SV39_PTE_PPN(pte) & MMU_SVNAPOT_PPN_MASK) != MMU_SVNAPOT_PPN_64K)) {
 			return false;
 		}
 
@@ -57,6 +112,12 @@ static bool mmu_vg2pg_walk(emulator_t* emu, guest_vaddr vaddr, mmu_vg2pg_pte* pt
 				return false;
 			}
 			a = MMU_SV39_PTE_PPN(pte) << MMU_VG2PG_PAGE_SHIFT;
+			host_a = mmu_vg2pg_host_table(emu, a);
+
+			mmu_vg2pg_pwc_entry_t* pwc_entry = &emu->cpu.vg2pg_pwc[i][vpn_prefix[i] & (MMU_VG2PG_PWC_SIZE - 1)];
+			pwc_entry->tag = vpn_prefix[i];
+			pwc_entry->table = a;
+			pwc_entry->host_table = host_a;
 		}
 	}
 
@@ -71,6 +132,8 @@ bool mmu_vg2pg_translate(emulator_t* emu, mmu_vg2pg_access_type_t access_type, g
 
 	size_t tlb_index = (vaddr >> MMU_VG2PG_PAGE_SHIFT) & emu->cpu.vg2pg_tlb_mask;
 	mmu_vg2pg_tlb_entry_t* tlb_entry = &emu->cpu.vg2pg_tlb[tlb_index];
+	size_t napot_tlb_index = ((vaddr & MMU_SVNAPOT_64K_MASK) >> MMU_VG2PG_PAGE_SHIFT) & emu->cpu.vg2pg_tlb_mask;
+	mmu_vg2pg_tlb_entry_t* napot_tlb_entry = &emu->cpu.vg2pg_tlb[napot_tlb_index];
 
 	mmu_vg2pg_pte pte;
 	ssize_t levels_remaining;
@@ -81,13 +144,25 @@ bool mmu_vg2pg_translate(emulator_t* emu, mmu_vg2pg_access_type_t access_type, g
 		pte = tlb_entry->pte;
 		levels_remaining = (tlb_entry->tag & MMU_VG2PG_OFFSET_MASK) - 1;
 		pte_paddr = (guest_paddr)-1;
+	} else if (napot_tlb_entry->tag == ((vaddr & MMU_SVNAPOT_64K_MASK) | 1) &&
+		   (napot_tlb_entry->pte & MMU_VG2PG_PTE_N)) {
+		tlb_entry = napot_tlb_entry;
+		pte = tlb_entry->pte;
+		levels_remaining = 0;
+		pte_paddr = (guest_paddr)-1;
 	} else {
+		emu->cache_misses[EMU_CACHE_VG2PG_TLB]++;
 		if (!mmu_vg2pg_walk(emu, vaddr, &pte, &levels_remaining, &pte_paddr)) {
 			return false;
 		}
 
-		tlb_entry->tag = (vaddr & MMU_VG2PG_PAGE_MASK) |
-				 ((levels_remaining + 1) & MMU_VG2PG_OFFSET_MASK);
+		if (pte & MMU_VG2PG_PTE_N) {
+			tlb_entry = napot_tlb_entry;
+			tlb_entry->tag = (vaddr & MMU_SVNAPOT_64K_MASK) | 1;
+		} else {
+			tlb_entry->tag = (vaddr & MMU_VG2PG_PAGE_MASK) |
+					 ((levels_remaining + 1) & MMU_VG2PG_OFFSET_MASK);
+		}
 		tlb_entry->pte = pte;
 	}
 
@@ -144,9 +219,16 @@ bool mmu_vg2pg_translate(emulator_t* emu, mmu_vg2pg_access_type_t access_type, g
 	    (access_type == MMU_VG2PG_ACCESS_WRITE && !(pte & MMU_VG2PG_PTE_DIRTY))) {
 		bool update_pte;
 		if (pte_paddr == (guest_paddr)-1) {
+			/* NOTE : the cached PTE of a NAPOT range may have been walked from another page of the range, we
+			 *        update the PTE of the accessed page as long as it only differs by its A/D bits
+			 */
+			const mmu_vg2pg_pte ad_mask = MMU_VG2PG_PTE_ACCESSED | MMU_VG2PG_PTE_DIRTY;
 			mmu_vg2pg_pte new_pte;
 			update_pte = mmu_vg2pg_walk(emu, vaddr, &new_pte, &levels_remaining, &pte_paddr);
-			update_pte &= new_pte == pte;
+			update_pte &= (new_pte & ~ad_mask) == (pte & ~ad_mask);
+			if (update_pte) {
+				pte = new_pte;
+			}
 		} else {
 			update_pte = true;
 		}
@@ -165,16 +247,177 @@ bool mmu_vg2pg_translate(emulator_t* emu, mmu_vg2pg_access_type_t access_type, g
 	 *     * pa.pgoff = va.pgoff.
 	 *     * If i > 0, then this is a superpage translation and pa.ppn[i - 1 : 0] = va.vpn[i - 1 : 0].
 	 *     * pa.ppn[LEVELS - 1 : i] = pte.ppn[LEVELS - 1 : i].
+	 *    For a NAPOT PTE, pa.ppn[3 : 0] = va.vpn[3 : 0] (Svnapot).
 	 */
-	*paddr = (MMU_SV39_PTE_PPN(pte) << MMU_VG2PG_PAGE_SHIFT) |
+	guest_paddr ppn = MMU_SV39_PTE_PPN(pte);
+	if (pte & MMU_VG2PG_PTE_N) {
+		ppn = (ppn & ~MMU_SVNAPOT_PPN_MASK) | (vpn[0] & MMU_SVNAPOT_PPN_MASK);
+	}
+	*paddr = (ppn << MMU_VG2PG_PAGE_SHIFT) |
 		 (levels_remaining >= 2 ? vpn[1] << 21 : 0) |
 		 (levels_remaining >= 1 ? vpn[0] << 12 : 0) |
 		 (vaddr & MMU_VG2PG_OFFSET_MASK);
 	return true;
 }
 
+static void mmu_vg2h_flush_contexts(emulator_t* emu, uint8_t contexts) {
+	size_t tlb_size = emu->cpu.vg2h_tlb_mask + 1;
+	for (size_t i = 0; i < MMU_VG2H_CONTEXT_COUNT; i++) {
+		// NOTE : the TLB of a context isn't cleared again if it wasn't used since its last flush
+		if ((contexts & emu->cpu.vg2h_tlb_used) & (1 << i)) {
+			emu_clear_cache(&emu->cpu.vg2h_tlb[i * tlb_size], tlb_size * sizeof(emu->cpu.vg2h_tlb[0]));
+		}
+		if ((contexts & emu->cpu.vg2h_itlb_used) & (1 << i)) {
+			emu_clear_cache(&emu->cpu.vg2h_itlb[i * tlb_size], tlb_size * sizeof(emu->cpu.vg2h_itlb[0]));
+		}
+	}
+	emu->cpu.vg2h_tlb_used &= ~contexts;
+	emu->cpu.vg2h_itlb_used &= ~contexts;
+	emu->cpu.vg2h_fetch_page = MMU_VG2H_TLB_INVALID_TAG;
+}
+
+static uintptr_t mmu_vg2h_host_page(emulator_t* emu, guest_paddr paddr) {
+	mmu_pg2h_pte pte;
+	if (!mmu_pg2h_get_pte(emu, paddr, &pte) || (pte & MMU_PG2H_PTE_TYPE_MMIO)) {
+		return 0;
+	}
+	return pte & MMU_PG2H_PAGE_MASK;
+}
+
+void mmu_vg2h_tlb_fill(emulator_t* emu, mmu_vg2pg_access_type_t access_type, guest_vaddr vaddr, guest_paddr paddr) {
+	assert(access_type != MMU_VG2PG_ACCESS_EXEC);
+	emu->cache_misses[EMU_CACHE_VG2H_TLB]++;
+	uintptr_t host_page = mmu_vg2h_host_page(emu, paddr);
+	if (host_page == 0) {
+		return;
+	}
+
+	size_t tlb_size = emu->cpu.vg2h_tlb_mask + 1;
+	emu->cpu.vg2h_tlb_used |= 1 << ((emu->cpu.vg2h_data_tlb - emu->cpu.vg2h_tlb) / tlb_size);
+
+	guest_vaddr page = vaddr & MMU_VG2PG_PAGE_MASK;
+	guest_vaddr tag = MMU_VG2H_TLB_TAG(page, 1);
+	uintptr_t host_addend = host_page - page;
+	mmu_vg2h_tlb_entry_t* entry = &emu->cpu.vg2h_data_tlb[(vaddr >> MMU_VG2PG_PAGE_SHIFT) & emu->cpu.vg2h_tlb_mask];
+	if (entry->host_addend != host_addend || (entry->read_tag != tag && entry->write_tag != tag)) {
+		entry->read_tag = entry->write_tag = MMU_VG2H_TLB_INVALID_TAG;
+		entry->host_addend = host_addend;
+	}
+
+	// NOTE : a writable page is always readable, W=1 and R=0 is a reserved PTE encoding
+	entry->read_tag = tag;
+	if (access_type == MMU_VG2PG_ACCESS_WRITE) {
+		entry->write_tag = tag;
+		// NOTE : the writes going through this tag aren't tracked, the page is prepared when it is filled
+		mmu_pg2h_prepare_write(emu, paddr & MMU_VG2PG_PAGE_MASK, MMU_VG2PG_PAGE_SIZE);
+	}
+}
+
+void mmu_vg2h_itlb_fill(emulator_t* emu, guest_vaddr vaddr, guest_paddr paddr) {
+	emu->cache_misses[EMU_CACHE_VG2H_TLB]++;
+	uintptr_t host_page = mmu_vg2h_host_page(emu, paddr);
+	if (host_page == 0) {
+		return;
+	}
+
+	size_t tlb_size = emu->cpu.vg2h_tlb_mask + 1;
+	emu->cpu.vg2h_itlb_used |= 1 << ((emu->cpu.vg2h_fetch_itlb - emu->cpu.vg2h_itlb) / tlb_size);
+
+	guest_vaddr page = vaddr & MMU_VG2PG_PAGE_MASK;
+	mmu_vg2h_itlb_entry_t* entry = &emu->cpu.vg2h_fetch_itlb[(vaddr >> MMU_VG2PG_PAGE_SHIFT) & emu->cpu.vg2h_tlb_mask];
+	entry->tag = MMU_VG2H_TLB_TAG(page, 1);
+	entry->host_addend = host_page - page;
+
+	emu->cpu.vg2h_fetch_page = entry->tag;
+	emu->cpu.vg2h_fetch_page_addend = entry->host_addend;
+}
+
+void mmu_vg2h_flush_tlb(emulator_t* emu) {
+	mmu_vg2h_flush_contexts(emu, (1 << MMU_VG2H_CONTEXT_COUNT) - 1);
+	mmu_vg2pg_flush_pwc(emu);
+}
+
+void mmu_vg2h_flush_write_tags(emulator_t* emu) {
+	size_t tlb_size = emu->cpu.vg2h_tlb_mask + 1;
+	for (size_t i = 0; i < MMU_VG2H_CONTEXT_COUNT; i++) {
+		if (!(emu->cpu.vg2h_tlb_used & (1 << i))) {
+			continue;
+		}
+		mmu_vg2h_tlb_entry_t* tlb = &emu->cpu.vg2h_tlb[i * tlb_size];
+		for (size_t j = 0; j < tlb_size; j++) {
+			tlb[j].write_tag = MMU_VG2H_TLB_INVALID_TAG;
+		}
+	}
+
+#ifdef RISCV_EMULATOR_DYNAREC_X86_64_SUPPORT
+	if (emu->cpu.dynarec_enabled) {
+		dr_flush_page_cache_writes(emu);
+	}
+#endif
+}
+
 void mmu_vg2pg_flush_tlb(emulator_t* emu) {
 	size_t tlb_size = emu->cpu.vg2pg_tlb_mask + 1;
 	emu->cpu.tlb_or_cache_flush_pending = true;
-	memset(emu->cpu.vg2pg_tlb, 0, tlb_size * sizeof(emu->cpu.vg2pg_tlb[0]));
+	emu_clear_cache(emu->cpu.vg2pg_tlb, tlb_size * sizeof(emu->cpu.vg2pg_tlb[0]));
+	mmu_vg2pg_flush_pwc(emu);
+	mmu_vg2h_flush_contexts(emu, (1 << MMU_VG2H_CONTEXT_COUNT) - 1 - (1 << MMU_VG2H_CONTEXT_BARE));
+
+#ifdef RISCV_EMULATOR_DYNAREC_X86_64_SUPPORT
+	if (emu->cpu.dynarec_enabled) {
+		dr_flush_page_cache(emu);
+	}
+#endif
+}
+
+static mmu_vg2h_context_t mmu_vg2h_context(privilege_mode_t priv_mode, bool bare, bool sum) {
+	if (bare || priv_mode == M_MODE || priv_mode == UO_MODE) {
+		return MMU_VG2H_CONTEXT_BARE;
+	} else if (priv_mode == U_MODE) {
+		return MMU_VG2H_CONTEXT_U;
+	} else {
+		return sum ? MMU_VG2H_CONTEXT_S_SUM : MMU_VG2H_CONTEXT_S;
+	}
+}
+
+void mmu_vg2pg_context_changed(emulator_t* emu) {
+	bool mprv = (emu->cpu.csrs.mstatus >> 17) & 1;
+	bool sum = (emu->cpu.csrs.mstatus >> 18) & 1;
+	bool mxr = (emu->cpu.csrs.mstatus >> 19) & 1;
+	privilege_mode_t mpp = (emu->cpu.csrs.mstatus >> 11) & 3;
+	bool bare = (emu->cpu.csrs.satp >> 60) == 0;
+	bool translated_priv_mode = emu->cpu.priv_mode == S_MODE || emu->cpu.priv_mode == U_MODE;
+
+	emu->cpu.vg2pg_mode = MMU_VG2PG_MODE_BARE;
+	if (!bare && translated_priv_mode) {
+		emu->cpu.vg2pg_mode |= MMU_VG2PG_MODE_TRANSLATE_FETCH;
+	}
+	if (!bare && (translated_priv_mode || (mprv && (mpp == S_MODE || mpp == U_MODE)))) {
+		emu->cpu.vg2pg_mode |= MMU_VG2PG_MODE_TRANSLATE_DATA;
+	}
+
+	/* The unified TLB is split by context so that traps and returns from traps don't flush it, only MXR
+	 * changes the permissions in every translated context
+	 */
+	if (mxr != emu->cpu.vg2h_mxr) {
+		mmu_vg2h_flush_contexts(emu, (1 << MMU_VG2H_CONTEXT_COUNT) - 1 - (1 << MMU_VG2H_CONTEXT_BARE));
+		emu->cpu.vg2h_mxr = mxr;
+	}
+	privilege_mode_t data_priv_mode = (emu->cpu.priv_mode == M_MODE && mprv) ? mpp : emu->cpu.priv_mode;
+	mmu_vg2h_context_t data_context = mmu_vg2h_context(data_priv_mode, bare, sum);
+	// NOTE : SUM doesn't affect instruction fetches, S-mode fetches always use the ITLB of the context without it
+	mmu_vg2h_context_t fetch_context = mmu_vg2h_context(emu->cpu.priv_mode, bare, false);
+	size_t tlb_size = emu->cpu.vg2h_tlb_mask + 1;
+	emu->cpu.vg2h_data_tlb = &emu->cpu.vg2h_tlb[data_context * tlb_size];
+	emu->cpu.vg2h_fetch_itlb = &emu->cpu.vg2h_itlb[fetch_context * tlb_size];
+	emu->cpu.vg2h_fetch_page = MMU_VG2H_TLB_INVALID_TAG;
+
+	/* NOTE : the VG2PG TLB only caches the PTEs and permissions are checked on each access, the page
+	 *        cache of the dynarec isn't split by context and needs to be flushed
+	 */
+#ifdef RISCV_EMULATOR_DYNAREC_X86_64_SUPPORT
+	if (emu->cpu.dynarec_enabled) {
+		dr_flush_page_cache(emu);
+	}
+#endif
 }
@@ -3,6 +3,7 @@
 
 #include <assert.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 #include "isa.h"
 #include "mmu_paging_guest_to_host.h"
@@ -65,6 +66,20 @@ static_assert(MMU_VG2PG_OFFSET_MASK == MMU_PG2H_OFFSET_MASK &&
 #define MMU_SV39_PTE_PPN_2(x) (((x) >> 28) & 0x3ffffff)
 #define MMU_SV39_PTE_PPN(x)   (((x) >> 10) & 0xfffffffffff)
 
+/* MMU_SVNAPOT_PPN_MASK : mask of the lower bits of the physical page number of a NAPOT PTE encoding the size of
+ *                        the range, they are replaced by the lower bits of the virtual page number
+ */
+#define MMU_SVNAPOT_PPN_MASK 0xf
+
+/* MMU_SVNAPOT_PPN_64K : encoding of a 64 KiB range in the lower bits of the physical page number of a NAPOT PTE,
+ *                       it is the only size defined by Svnapot
+ */
+#define MMU_SVNAPOT_PPN_64K 0x8
+
+/* MMU_SVNAPOT_64K_MASK : mask to extract the base of the 64 KiB range of a guest virtual address
+ */
+#define MMU_SVNAPOT_64K_MASK ~0xffffull
+
 /* mmu_vg2pg_pte : typedef used to represent a page table entry in the guest page table
  */
 typedef guest_paddr mmu_vg2pg_pte;
@@ -72,11 +87,31 @@ typedef guest_paddr mmu_vg2pg_pte;
 /* mmu_vg2pg_tlb_entry_t : structure representing an entry in the VG2PG TLB
  */
 typedef struct mmu_vg2pg_tlb_entry_t {
-	// NOTE : we store the remaining levels in the lower bits of the tag
+	/* NOTE : we store the remaining levels in the lower bits of the tag, a NAPOT PTE covers its whole 64 KiB
+	 *        range from the entry of its first page
+	 */
 	guest_vaddr tag;
 	mmu_vg2pg_pte pte;
 } mmu_vg2pg_tlb_entry_t;
 
+/* MMU_VG2PG_PWC_BITS : number of significant bits of the VPN prefix used to index the page-walk cache
+ */
+#define MMU_VG2PG_PWC_BITS 5
+
+/* MMU_VG2PG_PWC_SIZE : number of entries per level in the page-walk cache
+ */
+#define MMU_VG2PG_PWC_SIZE (1 << MMU_VG2PG_PWC_BITS)
+
+/* mmu_vg2pg_pwc_entry_t : structure representing an entry in the page-walk cache, it caches a non-leaf PTE
+ *                         as the address of the next level table, all the entries refer to the root table
+ *                         stored in `cpu_t`
+ */
+typedef struct mmu_vg2pg_pwc_entry_t {
+	guest_vaddr tag;              // VPN prefix translated by the non-leaf PTEs
+	guest_paddr table;            // guest physical address of the next level table
+	mmu_vg2pg_pte* host_table;  // host pointer to the next level table, NULL if it isn't backed by RAM
+} mmu_vg2pg_pwc_entry_t;
+
 /* mmu_vg2pg_access_type_t : enum of the kinds of access that can be requested from the MMU
  */
 typedef enum mmu_vg2pg_access_type_t {
@@ -85,6 +120,55 @@ typedef enum mmu_vg2pg_access_type_t {
 	MMU_VG2PG_ACCESS_EXEC,
 } mmu_vg2pg_access_type_t;
 
+/* mmu_vg2pg_mode_t : bit field of the kinds of access translated by the MMU in the current context of
+ *                    the CPU, it is kept up to date by `mmu_vg2pg_context_changed`
+ */
+typedef enum mmu_vg2pg_mode_t {
+	MMU_VG2PG_MODE_BARE = 0,                     // Physical addresses are used directly (M-mode, UO-mode or bare satp)
+	MMU_VG2PG_MODE_TRANSLATE_FETCH = (1 << 0),  // Instruction fetches are translated
+	MMU_VG2PG_MODE_TRANSLATE_DATA = (1 << 1),   // Loads and stores are translated (including M-mode with MPRV)
+} mmu_vg2pg_mode_t;
+
+/* mmu_vg2h_tlb_entry_t : structure representing an entry in the unified guest virtual to host TLB
+ *                        a tag is the inverted base of a guest virtual page where the access is allowed in
+ *                        the context of the TLB, both tags refer to the page of `host_addend`
+ */
+typedef struct mmu_vg2h_tlb_entry_t {
+	guest_vaddr read_tag;
+	guest_vaddr write_tag;
+	uintptr_t host_addend;  // host address - guest virtual address
+} mmu_vg2h_tlb_entry_t;
+
+/* mmu_vg2h_itlb_entry_t : structure representing an entry in the instruction fetch TLB, it is kept separated from
+ *                         the unified TLB so data accesses don't evict the translations of the code
+ */
+typedef struct mmu_vg2h_itlb_entry_t {
+	guest_vaddr tag;
+	uintptr_t host_addend;  // host address - guest virtual address
+} mmu_vg2h_itlb_entry_t;
+
+/* MMU_VG2H_TLB_INVALID_TAG : tag of an empty mmu_vg2h_tlb_entry_t or mmu_vg2h_itlb_entry_t, it never matches
+ *                            as the tags are stored inverted and the lower bits of a page base are always cleared,
+ *                            zero-filled TLBs are empty without being initialized
+ */
+#define MMU_VG2H_TLB_INVALID_TAG ((guest_vaddr)0)
+
+/* MMU_VG2H_TLB_TAG : macro used to get the tag compared to a mmu_vg2h_tlb_entry_t for an access of SIZE bytes,
+ *                    the offset bits of a misaligned access are kept so it never matches and takes the slow path
+ */
+#define MMU_VG2H_TLB_TAG(vaddr, SIZE) (~((vaddr) & (MMU_VG2PG_PAGE_MASK | ((SIZE) - 1))))
+
+/* mmu_vg2h_context_t : enum of the translation contexts having their own unified TLB, the permissions cached
+ *                      in an entry are only valid for the context of its TLB
+ */
+typedef enum mmu_vg2h_context_t {
+	MMU_VG2H_CONTEXT_BARE,   // Untranslated accesses
+	MMU_VG2H_CONTEXT_U,      // Accesses translated with the permissions of U-mode
+	MMU_VG2H_CONTEXT_S,      // Accesses translated with the permissions of S-mode with SUM=0
+	MMU_VG2H_CONTEXT_S_SUM,  // Accesses translated with the permissions of S-mode with SUM=1
+	MMU_VG2H_CONTEXT_COUNT,
+} mmu_vg2h_context_t;
+
 /* mmu_vg2pg_translate : translate a guest virtual address to a guest physical address
  *                       returns true if the translation was successful
  *                       returns false otherwise
@@ -95,9 +179,49 @@ typedef enum mmu_vg2pg_access_type_t {
  */
 bool mmu_vg2pg_translate(emulator_t* emu, mmu_vg2pg_access_type_t access_type, guest_vaddr vaddr, guest_paddr* paddr);
 
-/* mmu_vg2pg_flush_tlb : invalidate all the entries in the VG2PG TLB
+/* mmu_vg2pg_flush_tlb : invalidate all the entries in the VG2PG TLB, the page-walk cache and in the unified TLB
+ *                       and the instruction fetch TLB of the translated contexts
  *     emulator_t* emu : pointer to the emulator
  */
 void mmu_vg2pg_flush_tlb(emulator_t* emu);
 
+/* mmu_vg2h_tlb_fill : fill an entry of the unified TLB of the current context after a successful translation of
+ *                     a data access, nothing is cached if the guest physical page isn't backed by RAM
+ *     emulator_t* emu                     : pointer to the emulator
+ *     mmu_vg2pg_access_type_t access_type : allowed access type, MMU_VG2PG_ACCESS_READ or MMU_VG2PG_ACCESS_WRITE
+ *     guest_vaddr vaddr                   : translated virtual address
+ *     guest_paddr paddr                   : resulting physical address
+ */
+void mmu_vg2h_tlb_fill(emulator_t* emu, mmu_vg2pg_access_type_t access_type, guest_vaddr vaddr, guest_paddr paddr);
+
+/* mmu_vg2h_itlb_fill : fill an entry of the instruction fetch TLB of the current context and the last fetched page
+ *                      after a successful translation of an instruction fetch, nothing is cached if the guest
+ *                      physical page isn't backed by RAM
+ *     emulator_t* emu   : pointer to the emulator
+ *     guest_vaddr vaddr : translated virtual address
+ *     guest_paddr paddr : resulting physical address
+ */
+void mmu_vg2h_itlb_fill(emulator_t* emu, guest_vaddr vaddr, guest_paddr paddr);
+
+/* mmu_vg2h_flush_tlb : invalidate all the entries in the unified TLB and the instruction fetch TLB of every context
+ *                      and in the page-walk cache, it must be called when a RAM page is unmapped from the guest
+ *                      physical memory as they store host pointers
+ *     emulator_t* emu : pointer to the emulator
+ */
+void mmu_vg2h_flush_tlb(emulator_t* emu);
+
+/* mmu_vg2h_flush_write_tags : invalidate the write tags of the unified TLB of every context and of the page cache
+ *                             of the dynarec, the next write to each page goes through the slow path again
+ *     emulator_t* emu : pointer to the emulator
+ */
+void mmu_vg2h_flush_write_tags(emulator_t* emu);
+
+/* mmu_vg2pg_context_changed : notify the MMU that the privilege mode, the mode of satp or the bits
+ *                             of mstatus affecting the translation (MPRV, MPP, SUM and MXR) may
+ *                             have changed, the translation mode of the CPU is updated and the
+ *                             caches depending on them are flushed
+ *     emulator_t* emu : pointer to the emulator
+ */
+void mmu_vg2pg_context_changed(emulator_t* emu);
+
 #endif
@@ -1,12 +1,20 @@
+#define _GNU_SOURCE
+
 #include <assert.h>
+#include <fcntl.h>
+#include <inttypes.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <sys/mman.h>
+#include <unistd.h>
 
 #include "emulator.h"
 #include "isa.h"
+#include "mmu_paging_guest_to_guest.h"
 #include "mmu_paging_guest_to_host.h"
 
 static void* mmu_pg2h_map_page_table(void) {
@@ -20,6 +28,25 @@ static void* mmu_pg2h_map_page_table(void) {
 	return page;
 }
 
+static inline mmu_pg2h_ram_region_t* mmu_pg2h_find_ram_region(emulator_t* emu, guest_paddr addr) {
+	for (size_t i = 0; i < emu->pg2h_ram_regions_len; i++) {
+		mmu_pg2h_ram_region_t* region = &emu->pg2h_ram_regions[i];
+		// NOTE : the unsigned subtraction wraps around for addresses below the base of the region
+		if (addr - region->base < region->size) {
+			return region;
+		}
+	}
+	return NULL;
+}
+
+#define MMU_PG2H_DIRTY_BITMAP_SIZE(size) ((((size) / MMU_PG2H_PAGE_SIZE) + 63) / 64 * sizeof(uint64_t))
+
+static uint64_t* mmu_pg2h_alloc_dirty_bitmap(size_t size) {
+	uint64_t* dirty_bitmap = calloc(1, MMU_PG2H_DIRTY_BITMAP_SIZE(size));
+	assert(dirty_bitmap != NULL);
+	return dirty_bitmap;
+}
+
 static bool mmu_pg2h_walk_and_allocate(emulator_t* emu, guest_paddr guest_physical_page, mmu_pg2h_pte** pte) {
 	if ((guest_physical_page & MMU_PG2H_OFFSET_MASK) != 0) {
 		// The guest physical address isn't aligned to a page boundary
@@ -65,6 +92,11 @@ bool mmu_pg2h_map(emulator_t* emu, guest_paddr guest_physical_page, void* host_p
 		return false;
 	}
 
+	if (mmu_pg2h_find_ram_region(emu, guest_physical_page) != NULL) {
+		// This guest physical page is already mapped by a RAM region
+		return false;
+	}
+
 	mmu_pg2h_pte* level0_entry;
 	if (!mmu_pg2h_walk_and_allocate(emu, guest_physical_page, &level0_entry)) {
 		return false;
@@ -83,6 +115,11 @@ bool mmu_pg2h_map(emulator_t* emu, guest_paddr guest_physical_page, void* host_p
 }
 
 bool mmu_pg2h_map_mmio(emulator_t* emu, guest_paddr guest_physical_page, size_t page_index, size_t device_index) {
+	if (mmu_pg2h_find_ram_region(emu, guest_physical_page) != NULL) {
+		// This guest physical page is already mapped by a RAM region
+		return false;
+	}
+
 	mmu_pg2h_pte* level0_entry;
 	if (!mmu_pg2h_walk_and_allocate(emu, guest_physical_page, &level0_entry)) {
 		return false;
@@ -102,6 +139,35 @@ bool mmu_pg2h_map_mmio(emulator_t* emu, guest_paddr guest_physical_page, size_t
 	return true;
 }
 
+static bool mmu_pg2h_range_is_unmapped(emulator_t* emu, guest_paddr base, size_t size) {
+	guest_paddr addr = base;
+	while (addr - base < size) {
+		mmu_pg2h_pte current_level_pte = emu->pg2h_paging_table;
+		size_t level_shift[] = {30, 21, 12};
+		size_t level_ppn[] = {MMU_PG2H_PPN_2(addr), MMU_PG2H_PPN_1(addr), MMU_PG2H_PPN_0(addr)};
+		size_t i = 0;
+		for (; i < 3; i++) {
+			if (!(current_level_pte & MMU_PG2H_PTE_VALID)) {
+				break;
+			}
+			current_level_pte = ((mmu_pg2h_pte*)(current_level_pte & MMU_PG2H_PAGE_MASK))[level_ppn[i]];
+		}
+		if (i == 0) {
+			// The page table is empty
+			return true;
+		} else if (i == 3 && (current_level_pte & MMU_PG2H_PTE_VALID)) {
+			return false;
+		}
+
+		// NOTE : a missing table means the whole range it would have covered is unmapped, we skip it at once
+		addr = (addr & ~((1ull << level_shift[i - 1]) - 1)) + (1ull << level_shift[i - 1]);
+		if (addr == 0) {
+			break;
+		}
+	}
+	return true;
+}
+
 static bool mmu_pg2h_walk(emulator_t* emu, guest_paddr guest_physical_page, mmu_pg2h_pte** pte) {
 	if ((guest_physical_page & MMU_PG2H_OFFSET_MASK) != 0) {
 		// The guest physical address isn't aligned to a page boundary
@@ -155,13 +221,397 @@ bool mmu_pg2h_unmap(emulator_t* emu, guest_paddr guest_physical_page) {
 	if (tlb_entry->tag == guest_physical_page) {
 		tlb_entry->pte = 0;
 	}
+	// NOTE : the unified TLB is indexed by guest virtual addresses, we can't only invalidate the entries of this page
+	mmu_vg2h_flush_tlb(emu);
+
+	return true;
+}
+
+static mmu_pg2h_dedup_t* mmu_pg2h_dedup_create(int memfd, size_t size) {
+	size_t pages = size / MMU_PG2H_PAGE_SIZE;
+	// NOTE : every slot is shared by at least two pages
+	size_t slots_max = pages / 2 > 0 ? pages / 2 : 1;
+	if (ftruncate(memfd, size + slots_max * MMU_PG2H_PAGE_SIZE) != 0) {
+		perror("ftruncate");
+		return NULL;
+	}
+
+	mmu_pg2h_dedup_t* dedup = malloc(sizeof(mmu_pg2h_dedup_t));
+	assert(dedup != NULL);
+	dedup->memfd = memfd;
+	dedup->slots_max = slots_max;
+	dedup->slots_len = 0;
+	dedup->free_slots_len = 0;
+	dedup->shared_pages = 0;
+	dedup->page_slots = calloc(pages, sizeof(uint32_t));
+	dedup->slot_refcounts = calloc(slots_max, sizeof(uint32_t));
+	dedup->free_slots = malloc(slots_max * sizeof(uint32_t));
+	dedup->written_bitmap = mmu_pg2h_alloc_dirty_bitmap(size);
+	dedup->pin_counts = calloc(pages, sizeof(uint16_t));
+	assert(dedup->page_slots != NULL && dedup->slot_refcounts != NULL && dedup->free_slots != NULL &&
+	       dedup->pin_counts != NULL);
+	return dedup;
+}
+
+static void mmu_pg2h_dedup_free(mmu_pg2h_dedup_t* dedup) {
+	close(dedup->memfd);
+	free(dedup->page_slots);
+	free(dedup->slot_refcounts);
+	free(dedup->free_slots);
+	free(dedup->written_bitmap);
+	free(dedup->pin_counts);
+	free(dedup);
+}
+
+bool mmu_pg2h_map_ram(emulator_t* emu, guest_paddr base, size_t size, void* host_base, int memfd) {
+	if ((base & MMU_PG2H_OFFSET_MASK) != 0 || (size & MMU_PG2H_OFFSET_MASK) != 0 || size == 0 ||
+	    ((uintptr_t)host_base & MMU_PG2H_OFFSET_MASK) != 0) {
+		// The region isn't aligned to a page boundary
+		return false;
+	}
+	if (base + size - 1 < base) {
+		// The region wraps around the address space
+		return false;
+	}
+
+	for (size_t i = 0; i < emu->pg2h_ram_regions_len; i++) {
+		mmu_pg2h_ram_region_t* region = &emu->pg2h_ram_regions[i];
+		if (base < region->base + region->size && region->base < base + size) {
+			// The region overlaps with another RAM region
+			return false;
+		}
+	}
+	if (!mmu_pg2h_range_is_unmapped(emu, base, size)) {
+		// The region overlaps with pages of the page table
+		return false;
+	}
+
+	if (emu->pg2h_ram_regions_len == MMU_PG2H_RAM_REGIONS_MAX) {
+		fprintf(stderr, "Too many RAM regions\n");
+		return false;
+	}
 
+	mmu_pg2h_dedup_t* dedup = NULL;
+	if (memfd >= 0) {
+		dedup = mmu_pg2h_dedup_create(memfd, size);
+		if (dedup == NULL) {
+			return false;
+		}
+		emu->pg2h_dedup_enabled = true;
+	}
+
+	uint64_t* dirty_bitmap = NULL;
+	if (emu->pg2h_dirty_log_enabled) {
+		// NOTE : the content of the region changed since the last time the dirty bits were fetched
+		dirty_bitmap = mmu_pg2h_alloc_dirty_bitmap(size);
+		memset(dirty_bitmap, 0xff, MMU_PG2H_DIRTY_BITMAP_SIZE(size));
+	}
+
+	emu->pg2h_ram_regions[emu->pg2h_ram_regions_len++] = (mmu_pg2h_ram_region_t){
+		.base = base,
+		.size = size,
+		.host_base = host_base,
+		.dirty_bitmap = dirty_bitmap,
+		.dedup = dedup,
+	};
 	return true;
 }
 
+uint8_t* mmu_pg2h_get_ram(emulator_t* emu, guest_paddr addr, size_t* len) {
+	mmu_pg2h_ram_region_t* region = mmu_pg2h_find_ram_region(emu, addr);
+	if (region == NULL) {
+		return NULL;
+	}
+	*len = region->size - (addr - region->base);
+	return region->host_base + (addr - region->base);
+}
+
+void mmu_pg2h_dirty_log_enable(emulator_t* emu, bool enabled) {
+	for (size_t i = 0; i < emu->pg2h_ram_regions_len; i++) {
+		mmu_pg2h_ram_region_t* region = &emu->pg2h_ram_regions[i];
+		free(region->dirty_bitmap);
+		region->dirty_bitmap = enabled ? mmu_pg2h_alloc_dirty_bitmap(region->size) : NULL;
+	}
+	emu->pg2h_dirty_log_enabled = enabled;
+
+	// NOTE : the write tags of the TLBs were filled without marking the pages as dirty
+	mmu_vg2h_flush_write_tags(emu);
+}
+
+static void mmu_pg2h_dedup_unref_slot(mmu_pg2h_ram_region_t* region, size_t slot) {
+	mmu_pg2h_dedup_t* dedup = region->dedup;
+	assert(dedup->slot_refcounts[slot] > 0);
+	if (--dedup->slot_refcounts[slot] == 0) {
+		fallocate(dedup->memfd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+			  region->size + slot * MMU_PG2H_PAGE_SIZE, MMU_PG2H_PAGE_SIZE);
+		dedup->free_slots[dedup->free_slots_len++] = slot;
+	}
+}
+
+static void mmu_pg2h_dedup_remap(mmu_pg2h_ram_region_t* region, size_t page, int prot, off_t offset) {
+	uint8_t* host_page = region->host_base + page * MMU_PG2H_PAGE_SIZE;
+	if (mmap(host_page, MMU_PG2H_PAGE_SIZE, prot, MAP_SHARED | MAP_FIXED, region->dedup->memfd, offset) == MAP_FAILED) {
+		// NOTE : a failed MAP_FIXED mapping may leave a hole in the RAM, we can't recover from it
+		perror("mmap");
+		abort();
+	}
+}
+
+static void mmu_pg2h_dedup_share(mmu_pg2h_ram_region_t* region, size_t page, size_t slot) {
+	mmu_pg2h_dedup_t* dedup = region->dedup;
+	mmu_pg2h_dedup_remap(region, page, PROT_READ, region->size + slot * MMU_PG2H_PAGE_SIZE);
+	dedup->slot_refcounts[slot]++;
+
+	if (dedup->page_slots[page] == 0) {
+		fallocate(dedup->memfd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+			  page * MMU_PG2H_PAGE_SIZE, MMU_PG2H_PAGE_SIZE);
+		dedup->shared_pages++;
+	} else {
+		mmu_pg2h_dedup_unref_slot(region, dedup->page_slots[page] - 1);
+	}
+	dedup->page_slots[page] = slot + 1;
+}
+
+static void mmu_pg2h_dedup_unshare(mmu_pg2h_ram_region_t* region, size_t page) {
+	mmu_pg2h_dedup_t* dedup = region->dedup;
+	uint8_t* host_page = region->host_base + page * MMU_PG2H_PAGE_SIZE;
+	uint8_t content[MMU_PG2H_PAGE_SIZE];
+	memcpy(content, host_page, MMU_PG2H_PAGE_SIZE);
+	mmu_pg2h_dedup_remap(region, page, PROT_READ | PROT_WRITE, page * MMU_PG2H_PAGE_SIZE);
+	memcpy(host_page, content, MMU_PG2H_PAGE_SIZE);
+
+	mmu_pg2h_dedup_unref_slot(region, dedup->page_slots[page] - 1);
+	dedup->page_slots[page] = 0;
+	dedup->shared_pages--;
+}
+
+void mmu_pg2h_prepare_write(emulator_t* emu, guest_paddr addr, size_t len) {
+	if ((!emu->pg2h_dirty_log_enabled && !emu->pg2h_dedup_enabled) || len == 0) {
+		return;
+	}
+
+	mmu_pg2h_ram_region_t* region = mmu_pg2h_find_ram_region(emu, addr);
+	if (region == NULL) {
+		return;
+	}
+	size_t first_page = (addr - region->base) / MMU_PG2H_PAGE_SIZE;
+	size_t last_page = (addr - region->base + len - 1) / MMU_PG2H_PAGE_SIZE;
+	for (size_t page = first_page; page <= last_page && page < region->size / MMU_PG2H_PAGE_SIZE; page++) {
+		if (region->dirty_bitmap != NULL) {
+			region->dirty_bitmap[page / 64] |= 1ull << (page % 64);
+		}
+		if (region->dedup != NULL) {
+			region->dedup->written_bitmap[page / 64] |= 1ull << (page % 64);
+			if (region->dedup->page_slots[page] != 0) {
+				mmu_pg2h_dedup_unshare(region, page);
+			}
+		}
+	}
+}
+
+bool mmu_pg2h_dirty_log_fetch_and_clear(emulator_t* emu, guest_paddr base, size_t size, uint64_t* bitmap) {
+	if (!emu->pg2h_dirty_log_enabled ||
+	    (base & MMU_PG2H_OFFSET_MASK) != 0 || (size & MMU_PG2H_OFFSET_MASK) != 0 || size == 0) {
+		return false;
+	}
+	mmu_pg2h_ram_region_t* region = mmu_pg2h_find_ram_region(emu, base);
+	if (region == NULL || size > region->size - (base - region->base)) {
+		return false;
+	}
+
+	size_t first_page = (base - region->base) / MMU_PG2H_PAGE_SIZE;
+	size_t pages = size / MMU_PG2H_PAGE_SIZE;
+	memset(bitmap, 0, (pages + 63) / 64 * sizeof(uint64_t));
+	for (size_t i = 0; i < pages;) {
+		size_t page = first_page + i;
+		if ((page % 64) == 0 && (i % 64) == 0 && pages - i >= 64) {
+			bitmap[i / 64] = region->dirty_bitmap[page / 64];
+			region->dirty_bitmap[page / 64] = 0;
+			i += 64;
+		} else {
+			uint64_t page_bit = 1ull << (page % 64);
+			if (region->dirty_bitmap[page / 64] & page_bit) {
+				bitmap[i / 64] |= 1ull << (i % 64);
+				region->dirty_bitmap[page / 64] &= ~page_bit;
+			}
+			i++;
+		}
+	}
+
+	/* NOTE : the pages written through a write tag of the TLBs are only marked as dirty when the tag is filled,
+	 *        they must go through the slow path again to be marked on their next write
+	 */
+	mmu_vg2h_flush_write_tags(emu);
+	return true;
+}
+
+static uint64_t mmu_pg2h_dedup_hash(const uint8_t* host_page) {
+	// NOTE : FNV-1a over 64-bit words, the candidates are compared with memcmp anyway
+	const uint64_t* words = (const uint64_t*)host_page;
+	uint64_t hash = 0xcbf29ce484222325ull;
+	for (size_t i = 0; i < MMU_PG2H_PAGE_SIZE / sizeof(uint64_t); i++) {
+		hash = (hash ^ words[i]) * 0x100000001b3ull;
+	}
+	return hash;
+}
+
+static bool mmu_pg2h_dedup_merge(mmu_pg2h_ram_region_t* region, size_t page, size_t other_page) {
+	mmu_pg2h_dedup_t* dedup = region->dedup;
+	if (dedup->page_slots[page] != 0 && dedup->page_slots[page] == dedup->page_slots[other_page]) {
+		return true;
+	}
+	if (dedup->shared_pages + 2 > MMU_PG2H_DEDUP_SHARED_PAGES_MAX) {
+		return false;
+	}
+
+	size_t slot;
+	if (dedup->page_slots[other_page] != 0) {
+		slot = dedup->page_slots[other_page] - 1;
+	} else {
+		if (dedup->free_slots_len > 0) {
+			slot = dedup->free_slots[--dedup->free_slots_len];
+		} else if (dedup->slots_len < dedup->slots_max) {
+			slot = dedup->slots_len++;
+		} else {
+			return false;
+		}
+
+		const uint8_t* other_host_page = region->host_base + other_page * MMU_PG2H_PAGE_SIZE;
+		if (pwrite(dedup->memfd, other_host_page, MMU_PG2H_PAGE_SIZE,
+			   region->size + slot * MMU_PG2H_PAGE_SIZE) != MMU_PG2H_PAGE_SIZE) {
+			dedup->free_slots[dedup->free_slots_len++] = slot;
+			return false;
+		}
+		mmu_pg2h_dedup_share(region, other_page, slot);
+	}
+	mmu_pg2h_dedup_share(region, page, slot);
+	return true;
+}
+
+typedef struct mmu_pg2h_dedup_entry_t {
+	uint64_t hash;
+	size_t page;  // page index + 1, 0 for empty entries
+} mmu_pg2h_dedup_entry_t;
+
+static size_t mmu_pg2h_dedup_region(mmu_pg2h_ram_region_t* region) {
+	mmu_pg2h_dedup_t* dedup = region->dedup;
+	size_t pages = region->size / MMU_PG2H_PAGE_SIZE;
+	size_t freed_pages = 0;
+
+	// NOTE : the pages which were never touched aren't resident and don't cost any host memory
+	unsigned char* residency = malloc(pages);
+	assert(residency != NULL);
+	if (mincore(region->host_base, region->size, residency) != 0) {
+		perror("mincore");
+		free(residency);
+		return 0;
+	}
+
+	size_t candidates = 0;
+	for (size_t page = 0; page < pages; page++) {
+		bool written = dedup->written_bitmap[page / 64] & (1ull << (page % 64));
+		residency[page] = (residency[page] & 1) && !written && dedup->pin_counts[page] == 0;
+		candidates += residency[page];
+	}
+
+	size_t table_size = 1;
+	while (table_size < candidates * 2) {
+		table_size <<= 1;
+	}
+	mmu_pg2h_dedup_entry_t* table = calloc(table_size, sizeof(mmu_pg2h_dedup_entry_t));
+	assert(table != NULL);
+
+	for (size_t page = 0; page < pages; page++) {
+		if (!residency[page]) {
+			continue;
+		}
+
+		const uint8_t* host_page = region->host_base + page * MMU_PG2H_PAGE_SIZE;
+		uint64_t hash = mmu_pg2h_dedup_hash(host_page);
+		size_t index = hash & (table_size - 1);
+		while (table[index].page != 0 &&
+		       (table[index].hash != hash ||
+			memcmp(host_page, region->host_base + (table[index].page - 1) * MMU_PG2H_PAGE_SIZE, MMU_PG2H_PAGE_SIZE) != 0)) {
+			index = (index + 1) & (table_size - 1);
+		}
+
+		if (table[index].page == 0) {
+			table[index].hash = hash;
+			table[index].page = page + 1;
+			continue;
+		}
+
+		bool was_shared = dedup->page_slots[page] != 0 && dedup->page_slots[page] == dedup->page_slots[table[index].page - 1];
+		if (!mmu_pg2h_dedup_merge(region, page, table[index].page - 1)) {
+			break;
+		}
+		freed_pages += !was_shared;
+	}
+
+	free(table);
+	free(residency);
+	memset(dedup->written_bitmap, 0, MMU_PG2H_DIRTY_BITMAP_SIZE(region->size));
+	return freed_pages;
+}
+
+size_t mmu_pg2h_dedup(emulator_t* emu) {
+	size_t freed_pages = 0;
+	for (size_t i = 0; i < emu->pg2h_ram_regions_len; i++) {
+		if (emu->pg2h_ram_regions[i].dedup != NULL) {
+			freed_pages += mmu_pg2h_dedup_region(&emu->pg2h_ram_regions[i]);
+		}
+	}
+
+	/* NOTE : the pages written through a write tag of the TLBs are only prepared when the tag is filled, they
+	 *        must go through the slow path again to be tracked and to break the sharing of the merged pages
+	 */
+	mmu_vg2h_flush_write_tags(emu);
+	return freed_pages;
+}
+
+bool mmu_pg2h_dedup_release(emulator_t* emu, guest_paddr addr, size_t len) {
+	mmu_pg2h_ram_region_t* region = mmu_pg2h_find_ram_region(emu, addr);
+	if (region == NULL || region->dedup == NULL || len > region->size - (addr - region->base)) {
+		return false;
+	}
+
+	// NOTE : madvise doesn't free the pages of a shared mapping, they are still referenced by the memfd
+	return fallocate(region->dedup->memfd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+			 addr - region->base, len) == 0;
+}
+
+void mmu_pg2h_dedup_pin(emulator_t* emu, guest_paddr addr, size_t len, bool pinned) {
+	if (!emu->pg2h_dedup_enabled || len == 0) {
+		return;
+	}
+
+	mmu_pg2h_ram_region_t* region = mmu_pg2h_find_ram_region(emu, addr);
+	if (region == NULL || region->dedup == NULL) {
+		return;
+	}
+	size_t first_page = (addr - region->base) / MMU_PG2H_PAGE_SIZE;
+	size_t last_page = (addr - region->base + len - 1) / MMU_PG2H_PAGE_SIZE;
+	for (size_t page = first_page; page <= last_page && page < region->size / MMU_PG2H_PAGE_SIZE; page++) {
+		if (pinned) {
+			assert(region->dedup->pin_counts[page] < UINT16_MAX);
+			region->dedup->pin_counts[page]++;
+		} else {
+			assert(region->dedup->pin_counts[page] > 0);
+			region->dedup->pin_counts[page]--;
+		}
+	}
+}
+
 bool mmu_pg2h_get_pte(emulator_t* emu, guest_paddr addr, mmu_pg2h_pte* pte) {
 	guest_paddr guest_physical_page = addr & MMU_PG2H_PAGE_MASK;
 
+	mmu_pg2h_ram_region_t* region = mmu_pg2h_find_ram_region(emu, guest_physical_page);
+	if (region != NULL) {
+		*pte = (uintptr_t)(region->host_base + (guest_physical_page - region->base)) |
+		       MMU_PG2H_PTE_VALID | MMU_PG2H_PTE_TYPE_POOL;
+		return true;
+	}
+
 	size_t tlb_index = (guest_physical_page >> MMU_PG2H_PAGE_SHIFT) & emu->pg2h_tlb_mask;
 	mmu_pg2h_tlb_entry_t* tlb_entry = &emu->pg2h_tlb[tlb_index];
 	if ((tlb_entry->pte & MMU_PG2H_PTE_VALID) &&
@@ -169,6 +619,7 @@ bool mmu_pg2h_get_pte(emulator_t* emu, guest_paddr addr, mmu_pg2h_pte* pte) {
 		*pte = tlb_entry->pte;
 		return true;
 	}
+	emu->cache_misses[EMU_CACHE_PG2H_TLB]++;
 
 	mmu_pg2h_pte* level0_entry;
 	if (!mmu_pg2h_walk(emu, guest_physical_page, &level0_entry)) {
@@ -200,6 +651,16 @@ static void mmu_pg2h_free_level(mmu_pg2h_pte* table, size_t level) {
 }
 
 void mmu_pg2h_free(emulator_t* emu) {
+	for (size_t i = 0; i < emu->pg2h_ram_regions_len; i++) {
+		munmap(emu->pg2h_ram_regions[i].host_base, emu->pg2h_ram_regions[i].size);
+		free(emu->pg2h_ram_regions[i].dirty_bitmap);
+		if (emu->pg2h_ram_regions[i].dedup != NULL) {
+			mmu_pg2h_dedup_free(emu->pg2h_ram_regions[i].dedup);
+		}
+	}
+	emu->pg2h_ram_regions_len = 0;
+	emu->pg2h_dedup_enabled = false;
+
 	if (emu->pg2h_paging_table & MMU_PG2H_PTE_VALID) {
 		mmu_pg2h_free_level((mmu_pg2h_pte*)(emu->pg2h_paging_table & MMU_PG2H_PAGE_MASK), 3);
 	}
@@ -56,6 +56,45 @@ typedef struct mmu_pg2h_tlb_entry_t {
 	mmu_pg2h_pte pte;
 } mmu_pg2h_tlb_entry_t;
 
+/* MMU_PG2H_RAM_REGIONS_MAX : maximum number of flat RAM regions
+ */
+#define MMU_PG2H_RAM_REGIONS_MAX 8
+
+/* MMU_PG2H_DEDUP_SHARED_PAGES_MAX : maximum number of shared pages in a deduplicated RAM region
+ *     every shared page is a separate host mapping, the limit keeps the process far from vm.max_map_count
+ */
+#define MMU_PG2H_DEDUP_SHARED_PAGES_MAX 16384
+
+/* mmu_pg2h_dedup_t : structure storing the state of the copy-on-write deduplication of a flat RAM region
+ *     the region is a shared mapping of a memfd, pages with identical content are remapped read only to
+ *     a shared slot stored in the same file after the end of the region and their own content is punched
+ */
+typedef struct mmu_pg2h_dedup_t {
+	int memfd;
+	size_t slots_max;
+	size_t slots_len;
+	size_t free_slots_len;
+	size_t shared_pages;
+	uint32_t* page_slots;      // slot index + 1 of every page of the region, 0 for private pages
+	uint32_t* slot_refcounts;  // number of pages mapped to every slot
+	uint32_t* free_slots;      // stack of the slots released below slots_len
+	uint64_t* written_bitmap;  // pages written since the last deduplication pass
+	uint16_t* pin_counts;      // number of host transfers in flight on every page, pinned pages aren't shared
+} mmu_pg2h_dedup_t;
+
+/* mmu_pg2h_ram_region_t : structure representing a flat region of guest physical RAM backed by a
+ *                         single chunk of host memory
+ *     the regions are checked before the page table, the translation of an address within one of
+ *     them is a range check followed by an addition
+ */
+typedef struct mmu_pg2h_ram_region_t {
+	guest_paddr base;
+	size_t size;
+	uint8_t* host_base;
+	uint64_t* dirty_bitmap;
+	mmu_pg2h_dedup_t* dedup;
+} mmu_pg2h_ram_region_t;
+
 /* MMU_PG2H_PTE_VALID : flag marking a PTE as valid in the PG2H page table
  */
 #define MMU_PG2H_PTE_VALID (1 << 0)
@@ -99,6 +138,20 @@ typedef struct emulator_t emulator_t;
  */
 bool mmu_pg2h_map(emulator_t* emu, guest_paddr guest_physical_page, void* host_page);
 
+/* mmu_pg2h_map_ram : map a new flat RAM region
+ *                    on success, the region takes ownership of the host memory and of the memfd and
+ *                    releases them when freed
+ *                    returns true if the region was successfully mapped
+ *                    returns false otherwise
+ *     emulator_t* emu  : pointer to the emulator
+ *     guest_paddr base : guest physical address of the start of the region
+ *     size_t size      : size of the region
+ *     void* host_base  : host memory backing the region
+ *     int memfd        : memfd mapped as shared at host_base to enable the copy-on-write deduplication
+ *                        of the region, -1 otherwise
+ */
+bool mmu_pg2h_map_ram(emulator_t* emu, guest_paddr base, size_t size, void* host_base, int memfd);
+
 /* mmu_pg2h_map_mmio : map a new guest physical page to a MMIO device
  *                     returns true if the page was successfully mapped
  *                     returns false otherwise
@@ -111,7 +164,7 @@ bool mmu_pg2h_map_mmio(emulator_t* emu, guest_paddr guest_physical_page, size_t
 
 /* mmu_pg2h_unmap : unmap a guest physical page
  *                  returns true if the page was successfully unmapped
- *                  returns false otherwise
+ *                  returns false otherwise, pages of flat RAM regions can't be unmapped
  *     emulator_t* emu                 : pointer to the emulator
  *     guest_paddr guest_physical_page : guest physical page to unmap
  */
@@ -126,6 +179,70 @@ bool mmu_pg2h_unmap(emulator_t* emu, guest_paddr guest_physical_page);
  */
 bool mmu_pg2h_get_pte(emulator_t* emu, guest_paddr addr, mmu_pg2h_pte* pte);
 
+/* mmu_pg2h_get_ram : get the host address of a guest physical address within a flat RAM region
+ *                    returns a pointer to the host memory if the address is within a RAM region
+ *                    returns NULL otherwise
+ *     emulator_t* emu  : pointer to the emulator
+ *     guest_paddr addr : guest physical address to translate
+ *     size_t* len      : pointer to the size_t to fill with the number of bytes left in the region
+ */
+uint8_t* mmu_pg2h_get_ram(emulator_t* emu, guest_paddr addr, size_t* len);
+
+/* mmu_pg2h_dirty_log_enable : enable or disable the tracking of the pages of the flat RAM regions written since
+ *                             the last call to mmu_pg2h_dirty_log_fetch_and_clear, all the pages are clean when
+ *                             the tracking is enabled and the pages of regions mapped afterwards start dirty
+ *     emulator_t* emu : pointer to the emulator
+ *     bool enabled    : true to enable the tracking, false to disable it
+ */
+void mmu_pg2h_dirty_log_enable(emulator_t* emu, bool enabled);
+
+/* mmu_pg2h_prepare_write : mark the pages of a range of guest physical memory as dirty and break their
+ *                          copy-on-write sharing, it must be called before the write by every path writing to
+ *                          RAM without going through a write tag of the unified TLB
+ *     emulator_t* emu  : pointer to the emulator
+ *     guest_paddr addr : guest physical address of the start of the range about to be written
+ *     size_t len       : length of the range about to be written
+ */
+void mmu_pg2h_prepare_write(emulator_t* emu, guest_paddr addr, size_t len);
+
+/* mmu_pg2h_dirty_log_fetch_and_clear : copy the dirty bits of a range of guest physical pages and mark them as clean
+ *                                      returns true if the range is within a flat RAM region and the tracking is enabled
+ *                                      returns false otherwise
+ *     emulator_t* emu  : pointer to the emulator
+ *     guest_paddr base : guest physical address of the first page of the range
+ *     size_t size      : size of the range, a multiple of the page size
+ *     uint64_t* bitmap : bitmap to fill with one bit per page of the range, bit i of bitmap[j] represents the page
+ *                        at base + (j * 64 + i) * MMU_PG2H_PAGE_SIZE
+ */
+bool mmu_pg2h_dirty_log_fetch_and_clear(emulator_t* emu, guest_paddr base, size_t size, uint64_t* bitmap);
+
+/* mmu_pg2h_dedup : share the identical pages of the deduplicated RAM regions copy-on-write
+ *                  only the resident pages which weren't written since the previous pass and aren't pinned
+ *                  are considered
+ *                  returns the number of host pages freed by the pass
+ *     emulator_t* emu : pointer to the emulator
+ */
+size_t mmu_pg2h_dedup(emulator_t* emu);
+
+/* mmu_pg2h_dedup_release : release the host memory backing a range of pages of a deduplicated RAM region, the
+ *                          pages read as zero afterwards and mmu_pg2h_prepare_write must be called beforehand
+ *                          returns true if the range was released
+ *                          returns false if the range isn't within a deduplicated RAM region
+ *     emulator_t* emu  : pointer to the emulator
+ *     guest_paddr addr : guest physical address of the first page of the range
+ *     size_t len       : length of the range, a multiple of the page size
+ */
+bool mmu_pg2h_dedup_release(emulator_t* emu, guest_paddr addr, size_t len);
+
+/* mmu_pg2h_dedup_pin : pin or unpin the pages of a range of guest physical memory accessed asynchronously by the
+ *                      host kernel, the deduplication passes don't remap the pinned pages under the transfer
+ *     emulator_t* emu  : pointer to the emulator
+ *     guest_paddr addr : guest physical address of the start of the range
+ *     size_t len       : length of the range
+ *     bool pinned      : true to pin the range before the transfer, false to unpin it once it completed
+ */
+void mmu_pg2h_dedup_pin(emulator_t* emu, guest_paddr addr, size_t len, bool pinned);
+
 /* mmu_pg2h_free : free all the allocated memory used by the page table
  *     emulator_t* emu : pointer to the emulator
  */
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+import glob
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+TESTS_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "tests", "advanced")
+EMULATOR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "riscv-emulator")
+ROM_SIZE = 0x10000
+RAM_SIZE = 0x100000
+DISK_SIZE = 1 << 20
+TIMEOUT = 60
+
+def parse_test(source):
+    options = []
+    expected = None
+    with open(source, "r") as source_file:
+        for line in source_file.readlines():
+            line = line.rstrip("\n")
+            if line.startswith("# OPTIONS :"):
+                options += line[len("# OPTIONS :"):].split()
+            elif line == "# EXPECTED":
+                expected = []
+            elif expected is not None and line.startswith("# "):
+                expected.append(line[2:])
+    return options, expected
+
+def build_test(source, build_dir):
+    name = os.path.splitext(os.path.basename(source))[0]
+    obj = os.path.join(build_dir, name + ".o")
+    rom = os.path.join(build_dir, name + ".bin")
+    subprocess.run(["llvm-mc", "-triple=riscv64", "-mattr=+m,+a", "-filetype=obj",
+                    "-I", TESTS_DIR, "-o", obj, source], check=True)
+    subprocess.run(["llvm-objcopy", "-O", "binary", obj, rom], check=True)
+    return rom
+
+def run_test(source, build_dir, disk, extra_options):
+    options, expected = parse_test(source)
+    if expected is None:
+        print("{} : no EXPECTED block".format(source), file=sys.stderr)
+        return False
+
+    rom = build_test(source, build_dir)
+    args = [EMULATOR, "--advanced", rom, "--rom-size", hex(ROM_SIZE), "--ram-size", hex(RAM_SIZE),
+            "--virt", disk] + options + extra_options
+    try:
+        result = subprocess.run(args, stdout=subprocess.PIPE, timeout=TIMEOUT)
+    except subprocess.TimeoutExpired:
+        print("{} : timeout".format(source), file=sys.stderr)
+        return False
+
+    output = result.stdout.decode("ascii", "replace").splitlines()
+    if result.returncode != 0 or output != expected:
+        print("{} : FAIL (exit code {})".format(source, result.returncode), file=sys.stderr)
+        for i in range(max(len(output), len(expected))):
+            got = output[i] if i < len(output) else ""
+            want = expected[i] if i < len(expected) else ""
+            print("    {} {:<20} {}".format(" " if got == want else "!", got, want), file=sys.stderr)
+        return False
+    print("{} : OK".format(source))
+    return True
+
+def main():
+    # NOTE : the arguments are passed to the emulator for every test (e.g. --dynarec)
+    extra_options = sys.argv[1:]
+    for tool in ("llvm-mc", "llvm-objcopy"):
+        if shutil.which(tool) is None:
+            print("Unable to find {} in PATH".format(tool), file=sys.stderr)
+            sys.exit(2)
+
+    failed = 0
+    with tempfile.TemporaryDirectory() as build_dir:
+        disk = os.path.join(build_dir, "disk.img")
+        with open(disk, "wb") as disk_file:
+            disk_file.truncate(DISK_SIZE)
+
+        for source in sorted(glob.glob(os.path.join(TESTS_DIR, "*.s"))):
+            if not run_test(source, build_dir, disk, extra_options):
+                failed += 1
+
+    sys.exit(1 if failed > 0 else 0)
+
+if __name__ == "__main__":
+    main()
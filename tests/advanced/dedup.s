@@ -0,0 +1,101 @@
+# OPTIONS : --dedup cow
+.include "prologue.inc"
+.equ MTIME, 0x2000bff8
+s_entry:
+  li s10, 0
+  li s11, 0
+  # pages 0..7 and 8..15 of 0x40000000 hold two different contents, identical within each half
+  li s2, 0x40000000
+  li t3, 0
+1: li t0, 0x0123456789abcdef
+  li t1, 8
+  bltu t3, t1, 2f
+  not t0, t0
+2: slli t4, t3, 12
+  add t4, t4, s2
+  li t1, 0
+3: add t2, t0, t1
+  add t5, t4, t1
+  sd t2, 0(t5)
+  addi t1, t1, 8
+  li t2, 4096
+  bne t1, t2, 3b
+  addi t3, t3, 1
+  li t1, 16
+  bne t3, t1, 1b
+  # the pages written since the previous pass are skipped, the second pass shares them
+  call wait_passes
+  # writes to a shared page only affect that page
+  li t0, 0x55
+  li t1, 0x40003028
+  sd t0, 0(t1)
+  li t0, 0x66
+  li t1, 0x40009ffc
+  sw t0, 0(t1)
+  li a0, 0x40003000
+  call checksum
+  call puthex
+  li a0, 0x40004000
+  call checksum
+  call puthex
+  li a0, 0x40009000
+  call checksum
+  call puthex
+  li a0, 0x4000a000
+  call checksum
+  call puthex
+  # restoring the content shares the page again, then a misaligned store crossing two shared pages unshares both
+  li t0, 0x0123456789abcdef + 0x28
+  li t1, 0x40003028
+  sd t0, 0(t1)
+  call wait_passes
+  li t0, -1
+  li t1, 0x40003ffc
+  sd t0, 0(t1)
+  li a0, 0x40003000
+  call checksum
+  call puthex
+  li a0, 0x40004000
+  call checksum
+  call puthex
+  li a0, 0x40005000
+  call checksum
+  call puthex
+  mv a0, s11
+  call puthex
+  call poweroff
+
+# wait_passes : spin for 2.5 seconds of the CLINT, long enough for two deduplication passes
+wait_passes:
+  li t0, MTIME
+  ld t1, 0(t0)
+  li t2, 25000000
+  add t2, t2, t1
+1: ld t1, 0(t0)
+  bltu t1, t2, 1b
+  ret
+
+# checksum : rotate and add the 512 double words of the page at a0
+checksum:
+  li t1, 512
+  mv t0, a0
+  li a0, 0
+1: ld t2, 0(t0)
+  add a0, a0, t2
+  slli t3, a0, 7
+  srli a0, a0, 57
+  or a0, a0, t3
+  addi t0, t0, 8
+  addi t1, t1, -1
+  bnez t1, 1b
+  ret
+
+# EXPECTED
+# 454b884bc7eba76f
+# 4001020408101020
+# e223f14408101121
+# 50810a4408101121
+# ae5e4e040810101f
+# 400102047e644230
+# 4001020408101020
+# 0000000000000000
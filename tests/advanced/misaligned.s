@@ -0,0 +1,78 @@
+.include "prologue.inc"
+s_entry:
+  li s10, 0
+  li s11, 0
+  # fill two RW pages, then mix misaligned accesses within the first page and across both
+  li s2, 0x40000000
+  li s6, 0x40001000
+  li t0, 0x1122334455667788
+  li t1, 0
+  li t2, 0x2000
+1: add t3, s2, t1
+  sd t0, 0(t3)
+  addi t0, t0, 0x111
+  addi t1, t1, 8
+  bne t1, t2, 1b
+  li s3, 0
+  li s4, 30
+2:
+  ld t0, 1(s2)
+  add s3, s3, t0
+  lw t0, -3(s6)
+  add s3, s3, t0
+  lhu t0, -1(s6)
+  add s3, s3, t0
+  ld t0, -6(s6)
+  add s3, s3, t0
+  sd s3, -5(s6)
+  sw s3, -2(s6)
+  sh s3, 33(s2)
+  ld t0, 30(s2)
+  add s3, s3, t0
+  ld t0, -8(s6)
+  add s3, s3, t0
+  addi s4, s4, -1
+  bnez s4, 2b
+  mv a0, s3
+  call puthex
+  # a store crossing into the read only page faults without writing its first half
+  li s2, 0x4000fffc
+  sd s3, 0(s2)
+  ld t0, 0(s2)
+  ld t1, -4(s2)
+  add a0, t0, t1
+  call puthex
+  # a load crossing into an unmapped page and a store into the read only page both fault
+  li s2, 0x40010ffc
+  ld t0, 0(s2)
+  sd t0, 0(s2)
+  # a misaligned store into code already run invalidates it
+  li s2, 0xc0060000
+  lla a1, stub
+  lw t0, 0(a1)
+  sw t0, 0(s2)
+  lw t0, 4(a1)
+  sw t0, 4(s2)
+  fence.i
+  jalr s2
+  mv s5, a0
+  li t0, 0x00806702a0051300
+  sd t0, -1(s2)
+  jalr s2
+  add a0, a0, s5
+  call puthex
+  mv a0, s11
+  call puthex
+  mv a0, s10
+  call puthex
+  call poweroff
+stub:
+  li a0, 17
+  ret
+
+# EXPECTED
+# 894f44af4ab2b1e4
+# 4ab2b1e44ab2b1e4
+# 000000000000003b
+# 0000000000000003
+# 00000000c0032027
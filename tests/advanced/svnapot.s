@@ -0,0 +1,61 @@
+.include "prologue.inc"
+s_entry:
+  li s10, 0
+  li s11, 0
+  # l0[32..47] : 64 KiB NAPOT range 0x40020000 -> 0xc0030000, RW without A/D
+  li t1, 0xc0002000
+  li t0, ((0xc0038) << 10) | 0x07
+  li t2, 1
+  slli t2, t2, 63
+  or t0, t0, t2
+  li t4, 0
+1: slli t5, t4, 3
+  add t5, t5, t1
+  sd t0, 256(t5)
+  addi t4, t4, 1
+  li t6, 16
+  bne t4, t6, 1b
+  # l0[48] : N with a reserved range size
+  li t0, ((0xc0054) << 10) | 0xc7
+  or t0, t0, t2
+  sd t0, 384(t1)
+  sfence.vma
+  # a load sets A in the PTE of its page, a store to another page of the range then sets A and D in its own PTE
+  li s2, 0x40021010
+  ld t0, 0(s2)
+  li s2, 0x40026010
+  li t0, 0x55
+  sd t0, 0(s2)
+  li t1, 0xc0002000
+  ld a0, 304(t1)
+  andi a0, a0, 0xff
+  slli a0, a0, 8
+  ld t0, 264(t1)
+  andi t0, t0, 0xff
+  or a0, a0, t0
+  call puthex
+  # the lower bits of the PPN come from the virtual address
+  li s2, 0x40025008
+  li t0, 0xabcd
+  sd t0, 0(s2)
+  li s3, 0xc0035008
+  ld a0, 0(s3)
+  call puthex
+  li s3, 0xc0036010
+  ld a0, 0(s3)
+  call puthex
+  # a reserved range size faults
+  li s2, 0x40030000
+  ld t0, 0(s2)
+  mv a0, s11
+  call puthex
+  mv a0, s10
+  call puthex
+  call poweroff
+
+# EXPECTED
+# 000000000000c747
+# 000000000000abcd
+# 0000000000000055
+# 0000000000000001
+# 000000004003000d
@@ -0,0 +1,57 @@
+# The loops run long enough to be detected as hot, and are stepped one instruction at a time
+li a0, 0xc
+slli a0, a0, 28
+
+# Fill 0x1000 bytes with 0x5a
+li t0, 0x5a
+mv a1, a0
+lui a2, 0x1
+add a2, a2, a0
+sb t0, 0(a1)
+addi a1, a1, 1
+bne a1, a2, -8
+
+# Copy the first 0x800 bytes after them, with a zero at the end
+sb zero, 0x7ff(a0)
+mv a1, a0
+lui a3, 0x1
+add a3, a3, a0
+addi a2, a0, 0x7ff
+addi a2, a2, 1
+lbu t1, 0(a1)
+sb t1, 0(a3)
+addi a1, a1, 1
+addi a3, a3, 1
+bne a1, a2, -16
+
+# Scan the copy for its zero
+lui a1, 0x1
+add a1, a1, a0
+lbu t2, 0(a1)
+addi a1, a1, 1
+bne t2, zero, -8
+sub a1, a1, a0
+
+# Count down, the loop ends on a fused addi and bne
+li a2, 2000
+li a3, 0
+addi a3, a3, 3
+addi a2, a2, -1
+bne a2, zero, -8
+
+lbu a4, 0x7fe(a0)
+lui a5, 0x1
+add a5, a5, a0
+lbu a5, 0x7ff(a5)
+
+# EXPECTED
+# a0: 0xc0000000
+# a1: 0x1800
+# a2: 0
+# a3: 6000
+# a4: 0x5a
+# a5: 0
+# t0: 0x5a
+# t1: 0
+# t2: 0
+# sp: 16384